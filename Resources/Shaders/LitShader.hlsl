@@ -1,16 +1,45 @@
 //-------------------- Vertex Shader --------------------
 
+/**
+* QUANTIZED_VERTEX (set by main.cpp): compressed vertex streams.
+*	- position: R16G16B16A16_UNORM, relative to mesh bounds (see Object dequantization), w: tangent handedness (0: -1, 1: +1).
+*	- normal / tangent: R16G16_SNORM octahedral encoding.
+*	- uv: R16G16_FLOAT.
+*
+* Otherwise full floats, tangent handedness in tangent.w.
+*/
+#ifndef QUANTIZED_VERTEX
+#define QUANTIZED_VERTEX 0
+#endif
+
+#if QUANTIZED_VERTEX
+
+struct VertexFactory
+{
+	float4 position : POSITION;
+
+	float2 normal : NORMAL;
+
+	float2 tangent : TANGENT;
+
+	float2 uv : TEXCOORD;
+};
+
+#else
+
 struct VertexFactory
 {
 	float3 position : POSITION;
 
 	float3 normal : NORMAL;
 
-	float3 tangent : TANGENT;
+	float4 tangent : TANGENT;
 
 	float2 uv : TEXCOORD;
 };
 
+#endif
+
 
 struct VertexOutput
 {
@@ -30,6 +59,9 @@ struct VertexOutput
 
 	/// Vertex UV
 	float2 uv : TEXCOORD;
+
+	/// Object material: slice of the material texture arrays.
+	nointerpolation uint materialIndex : MATERIAL_INDEX;
 };
 
 //---------- Bindings ----------
@@ -53,6 +85,17 @@ struct Object
 {
 	/// Object transformation matrix.
 	float4x4 transform;
+
+	/// Quantized position dequantization (position = quantized * scale + offset).
+	float3 positionDequantScale;
+
+	/// -1 when transform mirrors the mesh (right-handed glTF data).
+	float tangentHandedness;
+
+	float3 positionDequantOffset;
+
+	/// Slice of the material texture arrays (MATERIAL_TEXTURE_ARRAY).
+	uint materialIndex;
 };
 cbuffer ObjectBuffer : register(b1)
 {
@@ -60,21 +103,48 @@ cbuffer ObjectBuffer : register(b1)
 };
 
 
+/// Octahedral coordinates in [-1, 1]^2 -> unit vector.
+float3 DecodeOctahedral(float2 _octahedral)
+{
+	float3 vec = float3(_octahedral, 1.0f - abs(_octahedral.x) - abs(_octahedral.y));
+
+	// Lower hemisphere: unfold the diagonals (SM5 ternary operator is per-component).
+	const float t = saturate(-vec.z);
+	vec.xy += vec.xy >= 0.0f ? -t : t;
+
+	return normalize(vec);
+}
+
+
 VertexOutput mainVS(VertexFactory _input)
 {
 	VertexOutput output;
 
+#if QUANTIZED_VERTEX
+	const float3 inPosition = _input.position.xyz * object.positionDequantScale + object.positionDequantOffset;
+	const float3 inNormal = DecodeOctahedral(_input.normal);
+	const float3 inTangent = DecodeOctahedral(_input.tangent);
+	const float inTangentSign = _input.position.w * 2.0 - 1.0;
+#else
+	const float3 inPosition = _input.position;
+	const float3 inNormal = _input.normal;
+	const float3 inTangent = _input.tangent.xyz;
+	const float inTangentSign = _input.tangent.w;
+#endif
+
 	//---------- Position ----------
-	const float4 worldPosition4 = mul(object.transform, float4(_input.position, 1.0));
+	const float4 worldPosition4 = mul(object.transform, float4(inPosition, 1.0));
 	output.worldPosition = worldPosition4.xyz / worldPosition4.w;
 	output.svPosition = mul(camera.invViewProj, worldPosition4);
 	output.viewPosition = float3(camera.view._14, camera.view._24, camera.view._34);
 
 
 	//---------- Normal ----------
-	const float3 normal = normalize(mul((float3x3)object.transform, _input.normal));
-	const float3 tangent = normalize(mul((float3x3)object.transform, _input.tangent));
-	const float3 bitangent = cross(normal, tangent);
+	const float3 normal = normalize(mul((float3x3)object.transform, inNormal));
+	const float3 tangent = normalize(mul((float3x3)object.transform, inTangent));
+
+	// MikkTSpace handedness: mirrored UVs flip the bitangent.
+	const float3 bitangent = cross(normal, tangent) * (inTangentSign * object.tangentHandedness);
 
 	/// HLSL uses row-major constructor: transpose to get TBN matrix.
 	output.TBN = transpose(float3x3(tangent, bitangent, normal));
@@ -82,6 +152,7 @@ VertexOutput mainVS(VertexFactory _input)
 
 	//---------- UV ----------
 	output.uv = _input.uv;
+	output.materialIndex = object.materialIndex;
 
 	return output;
 }
@@ -119,10 +190,41 @@ struct PointLight
 StructuredBuffer<PointLight> pointLights : register(t0);
 
 
-Texture2D<float4> albedo : register(t1);
-Texture2D<float3> normalMap : register(t2);
-Texture2D<float> metallicMap : register(t3);
-Texture2D<float> roughnessMap : register(t4);
+/**
+* ORM_TEXTURE (set by main.cpp): occlusion / roughness / metallic packed in one texture (R, G, B: glTF convention).
+* One sample instead of one per map. Occlusion is unused: no ambient lighting.
+*/
+#ifndef ORM_TEXTURE
+#define ORM_TEXTURE 0
+#endif
+
+/**
+* MATERIAL_TEXTURE_ARRAY (set by main.cpp): every PBR map is a Texture2DArray, one slice per material (object materialIndex).
+* Same descriptor table for every material.
+*/
+#ifndef MATERIAL_TEXTURE_ARRAY
+#define MATERIAL_TEXTURE_ARRAY 0
+#endif
+
+#if MATERIAL_TEXTURE_ARRAY
+#define MaterialTexture Texture2DArray
+#else
+#define MaterialTexture Texture2D
+#endif
+
+MaterialTexture<float4> albedo : register(t1);
+MaterialTexture<float2> normalMap : register(t2); // BC5: XY only, Z is rebuilt.
+
+#if ORM_TEXTURE
+
+MaterialTexture<float3> ormMap : register(t3);
+
+#else
+
+MaterialTexture<float> metallicMap : register(t3);
+MaterialTexture<float> roughnessMap : register(t4);
+
+#endif
 
 SamplerState pbrSampler : register(s0); // Use same sampler for all textures.
 
@@ -176,19 +278,34 @@ PixelOutput mainPS(PixelInput _input)
 	PixelOutput output;
 
 
+#if MATERIAL_TEXTURE_ARRAY
+	const float3 uv = float3(_input.uv, _input.materialIndex);
+#else
+	const float2 uv = _input.uv;
+#endif
+
+
 	//---------- Base Color ----------
-	const float4 baseColor = albedo.Sample(pbrSampler, _input.uv);
+	const float4 baseColor = albedo.Sample(pbrSampler, uv);
 
 	if (baseColor.a < 0.001)
 		discard;
 
 
 	//---------- Normal ----------
-	const float3 vnNormal = normalize(mul(_input.TBN, normalMap.Sample(pbrSampler, _input.uv) * 2.0f - 1.0f));
+	const float2 tnNormalXY = normalMap.Sample(pbrSampler, uv) * 2.0f - 1.0f;
+	const float3 tnNormal = float3(tnNormalXY, sqrt(saturate(1.0f - dot(tnNormalXY, tnNormalXY))));
+	const float3 vnNormal = normalize(mul(_input.TBN, tnNormal));
 
 	//---------- Lighting ----------
-	const float metallic = metallicMap.Sample(pbrSampler, _input.uv);
-	const float roughness = roughnessMap.Sample(pbrSampler, _input.uv);
+#if ORM_TEXTURE
+	const float3 orm = ormMap.Sample(pbrSampler, uv);
+	const float roughness = orm.g;
+	const float metallic = orm.b;
+#else
+	const float metallic = metallicMap.Sample(pbrSampler, uv);
+	const float roughness = roughnessMap.Sample(pbrSampler, uv);
+#endif
 	const float3 vnCamera = normalize(_input.viewPosition - _input.worldPosition);
 	const float3 f0 = lerp(float3(0.04, 0.04, 0.04), baseColor.xyz, metallic);
 
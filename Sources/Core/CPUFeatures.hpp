@@ -0,0 +1,42 @@
+#pragma once
+
+/**
+* x64 SIMD helpers.
+* SSE2 is always available on x64: it is the baseline path.
+* AVX2 paths are compiled for their functions only (TARGET_AVX2) and selected at runtime with CPUSupportsAVX2().
+* MSVC allows AVX2 intrinsics without /arch:AVX2, GCC/Clang require the function target attribute.
+*/
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+
+	#define TARGET_AVX2
+#else
+	#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+inline bool CPUSupportsAVX2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
+
+	// AVX support and OS saving YMM registers (OSXSAVE + XCR0).
+	__cpuid(info, 1);
+	const bool bOSXSave = (info[2] & (1 << 27)) != 0;
+	const bool bAVX = (info[2] & (1 << 28)) != 0;
+	if (!bOSXSave || !bAVX || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2");
+#endif
+}
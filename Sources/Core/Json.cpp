@@ -0,0 +1,259 @@
+#include "Core/Json.hpp"
+
+#include <charconv>
+
+namespace
+{
+	/// Max nesting: malformed input must not overflow the stack.
+	constexpr uint32_t maxDepth = 64u;
+
+	class JsonParser
+	{
+	public:
+		JsonParser(const char* _text, size_t _size, std::vector<JsonValue>& _values) :
+			mCurr{ _text },
+			mEnd{ _text + _size },
+			mValues{ _values }
+		{
+		}
+
+		bool ParseDocument()
+		{
+			if (!ParseValue(0u))
+				return false;
+
+			SkipWhitespaces();
+
+			return mCurr == mEnd;
+		}
+
+	private:
+		const char* mCurr = nullptr;
+		const char* mEnd = nullptr;
+
+		std::vector<JsonValue>& mValues;
+
+		void SkipWhitespaces()
+		{
+			while (mCurr < mEnd && (*mCurr == ' ' || *mCurr == '\t' || *mCurr == '\n' || *mCurr == '\r'))
+				++mCurr;
+		}
+
+		bool Consume(char _char)
+		{
+			SkipWhitespaces();
+
+			if (mCurr >= mEnd || *mCurr != _char)
+				return false;
+
+			++mCurr;
+			return true;
+		}
+
+		bool ConsumeLiteral(std::string_view _literal)
+		{
+			if (static_cast<size_t>(mEnd - mCurr) < _literal.size() || std::string_view(mCurr, _literal.size()) != _literal)
+				return false;
+
+			mCurr += _literal.size();
+			return true;
+		}
+
+		/// String content between quotes, escapes kept as-is.
+		bool ParseString(std::string_view& _out)
+		{
+			if (!Consume('"'))
+				return false;
+
+			const char* const begin = mCurr;
+
+			while (mCurr < mEnd && *mCurr != '"')
+			{
+				// Skip the escaped character (\" must not end the string).
+				if (*mCurr == '\\')
+					++mCurr;
+
+				++mCurr;
+			}
+
+			if (mCurr >= mEnd)
+				return false;
+
+			_out = std::string_view(begin, static_cast<size_t>(mCurr - begin));
+			++mCurr;
+
+			return true;
+		}
+
+		bool ParseValue(uint32_t _depth, std::string_view _key = {})
+		{
+			if (_depth > maxDepth)
+				return false;
+
+			SkipWhitespaces();
+
+			if (mCurr >= mEnd)
+				return false;
+
+			const uint32_t index = static_cast<uint32_t>(mValues.size());
+			mValues.push_back(JsonValue{ .key = _key });
+
+			// References into mValues are invalidated by children push_back: always index.
+			switch (*mCurr)
+			{
+				case '{':
+				{
+					++mCurr;
+					mValues[index].type = JsonType::Object;
+
+					uint32_t childNum = 0u;
+
+					if (!Consume('}'))
+					{
+						do
+						{
+							std::string_view key;
+
+							if (!ParseString(key) || !Consume(':') || !ParseValue(_depth + 1, key))
+								return false;
+
+							++childNum;
+						} while (Consume(','));
+
+						if (!Consume('}'))
+							return false;
+					}
+
+					mValues[index].childNum = childNum;
+					break;
+				}
+				case '[':
+				{
+					++mCurr;
+					mValues[index].type = JsonType::Array;
+
+					uint32_t childNum = 0u;
+
+					if (!Consume(']'))
+					{
+						do
+						{
+							if (!ParseValue(_depth + 1))
+								return false;
+
+							++childNum;
+						} while (Consume(','));
+
+						if (!Consume(']'))
+							return false;
+					}
+
+					mValues[index].childNum = childNum;
+					break;
+				}
+				case '"':
+				{
+					std::string_view string;
+
+					if (!ParseString(string))
+						return false;
+
+					mValues[index].type = JsonType::String;
+					mValues[index].string = string;
+					break;
+				}
+				case 't':
+				case 'f':
+				{
+					const bool bValue = *mCurr == 't';
+
+					if (!ConsumeLiteral(bValue ? "true" : "false"))
+						return false;
+
+					mValues[index].type = JsonType::Bool;
+					mValues[index].bValue = bValue;
+					break;
+				}
+				case 'n':
+				{
+					if (!ConsumeLiteral("null"))
+						return false;
+
+					break;
+				}
+				default:
+				{
+					double number = 0.0;
+
+					// from_chars doesn't accept the leading '+' (invalid JSON anyway).
+					const std::from_chars_result result = std::from_chars(mCurr, mEnd, number);
+					if (result.ec != std::errc{} || result.ptr == mCurr)
+						return false;
+
+					mCurr = result.ptr;
+
+					mValues[index].type = JsonType::Number;
+					mValues[index].number = number;
+					break;
+				}
+			}
+
+			mValues[index].end = static_cast<uint32_t>(mValues.size());
+
+			return true;
+		}
+	};
+}
+
+
+bool JsonDocument::Parse(const char* _text, size_t _size)
+{
+	mValues.clear();
+
+	// Rough estimate (1 value per 8 characters) to limit reallocations.
+	mValues.reserve(_size / 8u + 1u);
+
+	JsonParser parser(_text, _size, mValues);
+
+	if (!parser.ParseDocument())
+	{
+		mValues.assign(1u, JsonValue{ .end = 1u });
+		return false;
+	}
+
+	return true;
+}
+
+const JsonValue* JsonDocument::Find(const JsonValue& _object, std::string_view _key) const
+{
+	if (_object.type != JsonType::Object)
+		return nullptr;
+
+	for (uint32_t i = IndexOf(_object) + 1; i < _object.end; i = mValues[i].end)
+	{
+		if (mValues[i].key == _key)
+			return &mValues[i];
+	}
+
+	return nullptr;
+}
+
+const JsonValue* JsonDocument::At(const JsonValue& _array, uint32_t _index) const
+{
+	if (_array.type != JsonType::Array || _index >= _array.childNum)
+		return nullptr;
+
+	uint32_t i = IndexOf(_array) + 1;
+
+	for (uint32_t n = 0; n < _index; ++n)
+		i = mValues[i].end;
+
+	return &mValues[i];
+}
+
+double JsonDocument::GetNumber(const JsonValue& _object, std::string_view _key, double _default) const
+{
+	const JsonValue* const value = Find(_object, _key);
+
+	return value && value->type == JsonType::Number ? value->number : _default;
+}
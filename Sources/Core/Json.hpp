@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+/**
+* Minimal read-only JSON parser (glTF headers, tool configs).
+* Single pass into a flat array of values (no allocation per node): the children of a value follow it,
+* each value stores the index one past its subtree to skip it in O(1).
+* Strings are views into the source text: escape sequences are kept as-is (never needed for glTF keys and names),
+* the source must outlive the document.
+*/
+
+enum class JsonType : uint8_t
+{
+	Null,
+	Bool,
+	Number,
+	String,
+	Array,
+	Object,
+};
+
+struct JsonValue
+{
+	JsonType type = JsonType::Null;
+
+	bool bValue = false;
+	double number = 0.0;
+
+	/// String value (String) or member key (values of an Object).
+	std::string_view string;
+	std::string_view key;
+
+	/// Array / Object: number of direct children.
+	uint32_t childNum = 0u;
+
+	/// Index one past the last value of this subtree (next sibling).
+	uint32_t end = 0u;
+};
+
+class JsonDocument
+{
+public:
+	/// Return false on syntax error.
+	bool Parse(const char* _text, size_t _size);
+
+	const JsonValue& GetRoot() const { return mValues[0]; }
+
+	/// Object member, nullptr if missing or _object isn't an object.
+	const JsonValue* Find(const JsonValue& _object, std::string_view _key) const;
+
+	/// Array element, nullptr if out of range or _array isn't an array.
+	const JsonValue* At(const JsonValue& _array, uint32_t _index) const;
+
+	/// Member number, _default if missing or not a number.
+	double GetNumber(const JsonValue& _object, std::string_view _key, double _default) const;
+
+	/// Iterate over the direct children of an Array / Object.
+	template <typename FuncT>
+	void ForEach(const JsonValue& _parent, FuncT&& _func) const
+	{
+		if (_parent.type != JsonType::Array && _parent.type != JsonType::Object)
+			return;
+
+		for (uint32_t i = IndexOf(_parent) + 1; i < _parent.end; i = mValues[i].end)
+			_func(mValues[i]);
+	}
+
+private:
+	std::vector<JsonValue> mValues;
+
+	uint32_t IndexOf(const JsonValue& _value) const
+	{
+		return static_cast<uint32_t>(&_value - mValues.data());
+	}
+};
@@ -0,0 +1,129 @@
+#include "Core/MappedFile.hpp"
+
+#if _WIN32
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+
+#else
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#endif
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+#if _WIN32
+
+bool MappedFile::Open(const char* _path)
+{
+	Close();
+
+	HANDLE file = CreateFileA(_path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!data)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	mFile = file;
+	mMapping = mapping;
+	mData = static_cast<const uint8_t*>(data);
+	mSize = static_cast<uint64_t>(size.QuadPart);
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (mData)
+	{
+		UnmapViewOfFile(mData);
+		mData = nullptr;
+	}
+
+	if (mMapping)
+	{
+		CloseHandle(mMapping);
+		mMapping = nullptr;
+	}
+
+	if (mFile)
+	{
+		CloseHandle(mFile);
+		mFile = nullptr;
+	}
+
+	mSize = 0u;
+}
+
+#else
+
+bool MappedFile::Open(const char* _path)
+{
+	Close();
+
+	const int file = open(_path, O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat info;
+	if (fstat(file, &info) != 0 || info.st_size == 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* const data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+	// The mapping keeps a reference on the file.
+	close(file);
+
+	if (data == MAP_FAILED)
+		return false;
+
+	mData = static_cast<const uint8_t*>(data);
+	mSize = static_cast<uint64_t>(info.st_size);
+
+	return true;
+}
+
+void MappedFile::Close()
+{
+	if (mData)
+	{
+		munmap(const_cast<uint8_t*>(mData), static_cast<size_t>(mSize));
+		mData = nullptr;
+	}
+
+	mSize = 0u;
+}
+
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+* Read-only memory-mapped file.
+* Pages are loaded by the OS on first access: no intermediate read buffer, no copy.
+* Win32: CreateFileMapping / MapViewOfFile.
+* POSIX: mmap.
+*/
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/// Return false if the file doesn't exist or can't be mapped.
+	bool Open(const char* _path);
+	void Close();
+
+	const uint8_t* GetData() const { return mData; }
+	uint64_t GetSize() const { return mSize; }
+
+private:
+	const uint8_t* mData = nullptr;
+	uint64_t mSize = 0u;
+
+#if _WIN32
+	void* mFile = nullptr;
+	void* mMapping = nullptr;
+#endif
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+/**
+* Run _func(i) for every i in [0, _taskNum) on all hardware threads (calling thread included).
+* Tasks are fetched dynamically with an atomic counter: use coarse tasks (block of rows, block of triangles...).
+* Runs inline when there is a single task to avoid the thread creation cost.
+*/
+template <typename FuncT>
+void ParallelFor(uint32_t _taskNum, FuncT&& _func)
+{
+	const uint32_t hardwareThreadNum = (std::max)(1u, std::thread::hardware_concurrency());
+	const uint32_t threadNum = (std::min)(_taskNum, hardwareThreadNum);
+
+	if (threadNum <= 1u)
+	{
+		for (uint32_t i = 0; i < _taskNum; ++i)
+			_func(i);
+
+		return;
+	}
+
+	std::atomic<uint32_t> nextTask = 0u;
+
+	auto worker = [&]()
+	{
+		for (uint32_t i = nextTask++; i < _taskNum; i = nextTask++)
+			_func(i);
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadNum - 1);
+
+	for (uint32_t i = 0; i < threadNum - 1; ++i)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
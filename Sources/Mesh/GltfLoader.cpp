@@ -0,0 +1,680 @@
+#include "Mesh/GltfLoader.hpp"
+
+#include "Core/Json.hpp"
+#include "Core/MappedFile.hpp"
+#include "Mesh/VertexQuantization.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+namespace
+{
+	constexpr uint32_t glbMagic = 0x46546C67; // 'glTF'
+	constexpr uint32_t glbVersion = 2u;
+
+	constexpr uint32_t glbChunkJson = 0x4E4F534A; // 'JSON'
+	constexpr uint32_t glbChunkBin = 0x004E4942; // 'BIN\0'
+
+	constexpr uint64_t glbModeTriangles = 4u;
+
+	/// Missing glTF index (optional attributes / accessors).
+	constexpr uint64_t invalidIndex = ~0ull;
+
+	uint32_t ReadUInt32(const uint8_t* _data)
+	{
+		uint32_t value;
+		std::memcpy(&value, _data, sizeof(value));
+
+		return value;
+	}
+
+	uint32_t GetComponentSize(GlbComponentType _type)
+	{
+		switch (_type)
+		{
+			case GlbComponentType::Int8:
+			case GlbComponentType::UInt8:
+				return 1u;
+			case GlbComponentType::Int16:
+			case GlbComponentType::UInt16:
+				return 2u;
+			case GlbComponentType::UInt32:
+			case GlbComponentType::Float:
+				return 4u;
+			default:
+				return 0u;
+		}
+	}
+
+	uint32_t GetComponentNum(std::string_view _type)
+	{
+		if (_type == "SCALAR")
+			return 1u;
+		if (_type == "VEC2")
+			return 2u;
+		if (_type == "VEC3")
+			return 3u;
+		if (_type == "VEC4")
+			return 4u;
+
+		// Matrices: never used by mesh attributes.
+		return 0u;
+	}
+
+//{ Accessor read
+
+	/**
+	* Component _component of element _index as float.
+	* Normalized integers are remapped to [0, 1] (unsigned) or [-1, 1] (signed).
+	*/
+	float ReadComponent(const GlbAccessorView& _accessor, uint32_t _index, uint32_t _component)
+	{
+		const uint8_t* const src = _accessor.data + static_cast<size_t>(_index) * _accessor.stride + _component * GetComponentSize(_accessor.componentType);
+
+		switch (_accessor.componentType)
+		{
+			case GlbComponentType::Float:
+			{
+				float value;
+				std::memcpy(&value, src, sizeof(value));
+				return value;
+			}
+			case GlbComponentType::UInt8:
+				return _accessor.bNormalized ? src[0] / 255.0f : static_cast<float>(src[0]);
+			case GlbComponentType::Int8:
+			{
+				const int8_t value = static_cast<int8_t>(src[0]);
+				return _accessor.bNormalized ? (std::max)(value / 127.0f, -1.0f) : static_cast<float>(value);
+			}
+			case GlbComponentType::UInt16:
+			{
+				uint16_t value;
+				std::memcpy(&value, src, sizeof(value));
+				return _accessor.bNormalized ? value / 65535.0f : static_cast<float>(value);
+			}
+			case GlbComponentType::Int16:
+			{
+				int16_t value;
+				std::memcpy(&value, src, sizeof(value));
+				return _accessor.bNormalized ? (std::max)(value / 32767.0f, -1.0f) : static_cast<float>(value);
+			}
+			case GlbComponentType::UInt32:
+				return static_cast<float>(ReadUInt32(src));
+			default:
+				return 0.0f;
+		}
+	}
+
+	Float3 ReadFloat3(const GlbAccessorView& _accessor, uint32_t _index)
+	{
+		return Float3{ ReadComponent(_accessor, _index, 0), ReadComponent(_accessor, _index, 1), ReadComponent(_accessor, _index, 2) };
+	}
+
+	/// Index _index of a primitive: generated (0, 1, 2...) for non-indexed primitives.
+	uint32_t ReadIndex(const GlbAccessorView& _indices, uint32_t _index)
+	{
+		if (!_indices.data)
+			return _index;
+
+		const uint8_t* const src = _indices.data + static_cast<size_t>(_index) * _indices.stride;
+
+		switch (_indices.componentType)
+		{
+			case GlbComponentType::UInt8:
+				return src[0];
+			case GlbComponentType::UInt16:
+			{
+				uint16_t value;
+				std::memcpy(&value, src, sizeof(value));
+				return value;
+			}
+			default:
+				return ReadUInt32(src);
+		}
+	}
+
+	uint32_t GetIndexNum(const GlbPrimitiveView& _primitive)
+	{
+		return _primitive.indices.data ? _primitive.indices.count : _primitive.positions.count;
+	}
+
+	const GlbAccessorView& GetAccessor(const GlbPrimitiveView& _primitive, VertexSemantic _semantic)
+	{
+		switch (_semantic)
+		{
+			case VertexSemantic::Normal:
+				return _primitive.normals;
+			case VertexSemantic::Tangent:
+				return _primitive.tangents;
+			case VertexSemantic::UV:
+				return _primitive.uvs;
+			default:
+				return _primitive.positions;
+		}
+	}
+
+//}
+
+
+//{ JSON
+
+	/**
+	* glTF JSON chunk and BIN chunk, with the top-level arrays indexed once (JsonDocument::At() is linear).
+	*/
+	struct GlbDocument
+	{
+		JsonDocument json;
+
+		std::vector<const JsonValue*> accessors;
+		std::vector<const JsonValue*> bufferViews;
+
+		const uint8_t* bin = nullptr;
+		uint64_t binSize = 0u;
+	};
+
+	/// Non-negative integer member, _default if missing.
+	bool GetIndex(const JsonDocument& _json, const JsonValue& _object, std::string_view _key, uint64_t _default, uint64_t& _out)
+	{
+		const JsonValue* const member = _json.Find(_object, _key);
+
+		if (!member)
+		{
+			_out = _default;
+			return true;
+		}
+
+		const double value = member->number;
+
+		if (member->type != JsonType::Number || value < 0.0 || value > 1e15 || value != static_cast<double>(static_cast<uint64_t>(value)))
+			return false;
+
+		_out = static_cast<uint64_t>(value);
+
+		return true;
+	}
+
+	std::vector<const JsonValue*> GetArray(const JsonDocument& _json, std::string_view _key)
+	{
+		std::vector<const JsonValue*> values;
+
+		if (const JsonValue* array = _json.Find(_json.GetRoot(), _key))
+			_json.ForEach(*array, [&values](const JsonValue& _value) { values.push_back(&_value); });
+
+		return values;
+	}
+
+	bool ParseAccessor(const GlbDocument& _doc, uint64_t _accessorIndex, GlbAccessorView& _out)
+	{
+		if (_accessorIndex >= _doc.accessors.size())
+			return false;
+
+		const JsonDocument& json = _doc.json;
+		const JsonValue& accessor = *_doc.accessors[_accessorIndex];
+
+		// Sparse accessors and accessors without buffer view (zero-filled) need a copy: not supported.
+		if (json.Find(accessor, "sparse"))
+			return false;
+
+		uint64_t bufferViewIndex = 0u;
+		uint64_t accessorOffset = 0u;
+		uint64_t componentType = 0u;
+		uint64_t count = 0u;
+
+		if (!GetIndex(json, accessor, "bufferView", invalidIndex, bufferViewIndex) || bufferViewIndex >= _doc.bufferViews.size() ||
+			!GetIndex(json, accessor, "byteOffset", 0u, accessorOffset) ||
+			!GetIndex(json, accessor, "componentType", 0u, componentType) ||
+			!GetIndex(json, accessor, "count", 0u, count) || count > 0xFFFFFFFFull)
+			return false;
+
+		const JsonValue* const type = json.Find(accessor, "type");
+		const JsonValue* const normalized = json.Find(accessor, "normalized");
+
+		_out.componentType = static_cast<GlbComponentType>(componentType);
+		_out.componentNum = type && type->type == JsonType::String ? GetComponentNum(type->string) : 0u;
+		_out.bNormalized = normalized && normalized->type == JsonType::Bool && normalized->bValue;
+		_out.count = static_cast<uint32_t>(count);
+
+		const uint32_t elementSize = _out.GetElementSize();
+
+		if (elementSize == 0u)
+			return false;
+
+		const JsonValue& bufferView = *_doc.bufferViews[bufferViewIndex];
+
+		uint64_t buffer = 0u;
+		uint64_t viewOffset = 0u;
+		uint64_t viewLength = 0u;
+		uint64_t viewStride = 0u;
+
+		// GLB: buffer 0 is the BIN chunk.
+		if (!GetIndex(json, bufferView, "buffer", 0u, buffer) || buffer != 0u ||
+			!GetIndex(json, bufferView, "byteOffset", 0u, viewOffset) ||
+			!GetIndex(json, bufferView, "byteLength", 0u, viewLength) ||
+			!GetIndex(json, bufferView, "byteStride", 0u, viewStride))
+			return false;
+
+		if (viewOffset > _doc.binSize || viewLength > _doc.binSize - viewOffset)
+			return false;
+
+		_out.stride = viewStride ? static_cast<uint32_t>(viewStride) : elementSize;
+
+		if (viewStride != 0u && (viewStride < elementSize || viewStride > 252u))
+			return false;
+
+		const uint64_t accessorSize = count ? (count - 1) * _out.stride + elementSize : 0u;
+
+		if (accessorOffset > viewLength || accessorSize > viewLength - accessorOffset)
+			return false;
+
+		_out.data = _doc.bin + viewOffset + accessorOffset;
+
+		return true;
+	}
+
+	/// Optional attribute: stays empty (null data) if missing.
+	bool ParseAttribute(const GlbDocument& _doc, const JsonValue& _attributes, std::string_view _name, uint32_t _componentNum, uint32_t _vertexNum, GlbAccessorView& _out)
+	{
+		uint64_t accessorIndex = 0u;
+
+		if (!GetIndex(_doc.json, _attributes, _name, invalidIndex, accessorIndex))
+			return false;
+
+		if (accessorIndex == invalidIndex)
+			return true;
+
+		return ParseAccessor(_doc, accessorIndex, _out) && _out.componentNum == _componentNum && _out.count == _vertexNum;
+	}
+
+	bool ParsePrimitive(const GlbDocument& _doc, const JsonValue& _primitive, GlbFileView& _outView)
+	{
+		const JsonDocument& json = _doc.json;
+
+		uint64_t mode = 0u;
+
+		if (!GetIndex(json, _primitive, "mode", glbModeTriangles, mode))
+			return false;
+
+		// Points, lines, strips and fans: skipped.
+		if (mode != glbModeTriangles)
+			return true;
+
+		const JsonValue* const attributes = json.Find(_primitive, "attributes");
+		if (!attributes)
+			return false;
+
+		GlbPrimitiveView primitive;
+
+		uint64_t positionIndex = 0u;
+
+		if (!GetIndex(json, *attributes, "POSITION", invalidIndex, positionIndex) ||
+			!ParseAccessor(_doc, positionIndex, primitive.positions) ||
+			primitive.positions.componentNum != 3u || primitive.positions.componentType != GlbComponentType::Float)
+			return false;
+
+		const uint32_t vertexNum = primitive.positions.count;
+
+		if (!ParseAttribute(_doc, *attributes, "NORMAL", 3u, vertexNum, primitive.normals) ||
+			!ParseAttribute(_doc, *attributes, "TANGENT", 4u, vertexNum, primitive.tangents) ||
+			!ParseAttribute(_doc, *attributes, "TEXCOORD_0", 2u, vertexNum, primitive.uvs))
+			return false;
+
+		uint64_t indicesIndex = 0u;
+
+		if (!GetIndex(json, _primitive, "indices", invalidIndex, indicesIndex))
+			return false;
+
+		if (indicesIndex != invalidIndex)
+		{
+			if (!ParseAccessor(_doc, indicesIndex, primitive.indices) || primitive.indices.componentNum != 1u ||
+				(primitive.indices.componentType != GlbComponentType::UInt8 && primitive.indices.componentType != GlbComponentType::UInt16 && primitive.indices.componentType != GlbComponentType::UInt32))
+				return false;
+		}
+
+		const uint32_t indexNum = GetIndexNum(primitive);
+
+		if (vertexNum == 0u || indexNum == 0u || indexNum % 3u != 0u)
+			return true;
+
+		// Bounds: POSITION min / max are required by the specification, computed if missing.
+		const JsonValue& positionAccessor = *_doc.accessors[positionIndex];
+		const JsonValue* const min = json.Find(positionAccessor, "min");
+		const JsonValue* const max = json.Find(positionAccessor, "max");
+
+		if (min && max && min->childNum == 3u && max->childNum == 3u)
+		{
+			float bounds[2][3];
+
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				const JsonValue* const minValue = json.At(*min, i);
+				const JsonValue* const maxValue = json.At(*max, i);
+
+				bounds[0][i] = static_cast<float>(minValue->number);
+				bounds[1][i] = static_cast<float>(maxValue->number);
+			}
+
+			primitive.bounds = MeshBounds{
+				.min = Float3{ bounds[0][0], bounds[0][1], bounds[0][2] },
+				.max = Float3{ bounds[1][0], bounds[1][1], bounds[1][2] },
+			};
+		}
+		else
+		{
+			primitive.bounds = MeshBounds{ .min = ReadFloat3(primitive.positions, 0), .max = ReadFloat3(primitive.positions, 0) };
+
+			for (uint32_t i = 1; i < vertexNum; ++i)
+			{
+				const Float3 position = ReadFloat3(primitive.positions, i);
+
+				primitive.bounds.min = Float3{ (std::min)(primitive.bounds.min.x, position.x), (std::min)(primitive.bounds.min.y, position.y), (std::min)(primitive.bounds.min.z, position.z) };
+				primitive.bounds.max = Float3{ (std::max)(primitive.bounds.max.x, position.x), (std::max)(primitive.bounds.max.y, position.y), (std::max)(primitive.bounds.max.z, position.z) };
+			}
+		}
+
+		primitive.sphere = ComputeBoundingSphere(primitive.bounds);
+
+		_outView.submeshes.push_back(Submesh{
+			.indexOffset = _outView.indexNum,
+			.indexNum = indexNum,
+			.baseVertex = _outView.vertexNum,
+			.vertexNum = vertexNum,
+			.bounds = primitive.bounds,
+			.sphere = primitive.sphere,
+		});
+
+		_outView.vertexNum += vertexNum;
+		_outView.indexNum += indexNum;
+
+		_outView.primitives.push_back(primitive);
+
+		return true;
+	}
+
+//}
+}
+
+
+uint32_t GlbAccessorView::GetElementSize() const
+{
+	return GetComponentSize(componentType) * componentNum;
+}
+
+
+bool ParseGlb(const uint8_t* _data, uint64_t _size, GlbFileView& _outView)
+{
+	_outView = GlbFileView{};
+
+	// Header: magic, version, length. Then chunks: length, type, data (4 bytes aligned).
+	if (_size < 20u || ReadUInt32(_data) != glbMagic || ReadUInt32(_data + 4) != glbVersion)
+		return false;
+
+	const uint64_t fileSize = ReadUInt32(_data + 8);
+
+	if (fileSize < 20u || fileSize > _size)
+		return false;
+
+	GlbDocument doc;
+
+	const uint64_t jsonSize = ReadUInt32(_data + 12);
+
+	if (ReadUInt32(_data + 16) != glbChunkJson || jsonSize > fileSize - 20u)
+		return false;
+
+	const uint64_t binChunkOffset = 20u + jsonSize;
+
+	if (binChunkOffset + 8u <= fileSize && ReadUInt32(_data + binChunkOffset + 4) == glbChunkBin)
+	{
+		doc.binSize = ReadUInt32(_data + binChunkOffset);
+		doc.bin = _data + binChunkOffset + 8u;
+
+		if (doc.binSize > fileSize - binChunkOffset - 8u)
+			return false;
+	}
+
+	if (!doc.json.Parse(reinterpret_cast<const char*>(_data + 20), jsonSize))
+		return false;
+
+	doc.accessors = GetArray(doc.json, "accessors");
+	doc.bufferViews = GetArray(doc.json, "bufferViews");
+
+	const JsonValue* const meshes = doc.json.Find(doc.json.GetRoot(), "meshes");
+	if (!meshes)
+		return false;
+
+	bool bValid = true;
+
+	doc.json.ForEach(*meshes, [&](const JsonValue& _mesh)
+	{
+		if (const JsonValue* primitives = doc.json.Find(_mesh, "primitives"))
+		{
+			doc.json.ForEach(*primitives, [&](const JsonValue& _primitive)
+			{
+				bValid = bValid && ParsePrimitive(doc, _primitive, _outView);
+			});
+		}
+	});
+
+	if (!bValid || _outView.primitives.empty())
+		return false;
+
+	_outView.bounds = _outView.submeshes[0].bounds;
+
+	for (const Submesh& submesh : _outView.submeshes)
+	{
+		_outView.bounds.min = Float3{ (std::min)(_outView.bounds.min.x, submesh.bounds.min.x), (std::min)(_outView.bounds.min.y, submesh.bounds.min.y), (std::min)(_outView.bounds.min.z, submesh.bounds.min.z) };
+		_outView.bounds.max = Float3{ (std::max)(_outView.bounds.max.x, submesh.bounds.max.x), (std::max)(_outView.bounds.max.y, submesh.bounds.max.y), (std::max)(_outView.bounds.max.z, submesh.bounds.max.z) };
+
+		if (submesh.vertexNum > 0x10000)
+			_outView.indexFormat = IndexFormat::UInt32;
+	}
+
+	_outView.sphere = ComputeBoundingSphere(_outView.bounds);
+
+	return true;
+}
+
+
+bool WriteGlbVertexStream(const GlbFileView& _view, VertexSemantic _semantic, VertexFormat _format, const MeshBounds& _quantizationBounds, void* _dst)
+{
+	uint8_t* dst = static_cast<uint8_t*>(_dst);
+
+	const uint32_t formatSize = GetVertexFormatSize(_format);
+	const PositionDequantization dequantization = ComputePositionDequantization(_quantizationBounds);
+
+	auto quantizeAxis = [](float _value, float _scale, float _offset)
+	{
+		return _scale > 0.0f ? QuantizeUNorm16((_value - _offset) / _scale) : uint16_t(0u);
+	};
+
+	for (const GlbPrimitiveView& primitive : _view.primitives)
+	{
+		const GlbAccessorView& accessor = GetAccessor(primitive, _semantic);
+		const uint32_t vertexNum = primitive.positions.count;
+
+		if (!accessor.data)
+			return false;
+
+		switch (_format)
+		{
+			case VertexFormat::Float2:
+			case VertexFormat::Float3:
+			case VertexFormat::Float4:
+			{
+				const uint32_t componentNum = formatSize / sizeof(float);
+
+				if (accessor.componentNum != componentNum)
+					return false;
+
+				// Same layout as the input layout: single copy.
+				if (accessor.componentType == GlbComponentType::Float && accessor.IsTightlyPacked())
+				{
+					std::memcpy(dst, accessor.data, static_cast<size_t>(vertexNum) * formatSize);
+					break;
+				}
+
+				for (uint32_t v = 0; v < vertexNum; ++v)
+				{
+					float values[4];
+
+					for (uint32_t c = 0; c < componentNum; ++c)
+						values[c] = ReadComponent(accessor, v, c);
+
+					std::memcpy(dst + static_cast<size_t>(v) * formatSize, values, formatSize);
+				}
+
+				break;
+			}
+			case VertexFormat::UNorm16x4:
+			{
+				if (_semantic != VertexSemantic::Position)
+					return false;
+
+				for (uint32_t v = 0; v < vertexNum; ++v)
+				{
+					const Float3 position = ReadFloat3(accessor, v);
+					const bool bNegativeHandedness = primitive.tangents.data && ReadComponent(primitive.tangents, v, 3) < 0.0f;
+
+					const uint16_t values[4]{
+						quantizeAxis(position.x, dequantization.scale.x, dequantization.offset.x),
+						quantizeAxis(position.y, dequantization.scale.y, dequantization.offset.y),
+						quantizeAxis(position.z, dequantization.scale.z, dequantization.offset.z),
+						bNegativeHandedness ? uint16_t(0u) : uint16_t(0xFFFFu),
+					};
+
+					std::memcpy(dst + static_cast<size_t>(v) * formatSize, values, formatSize);
+				}
+
+				break;
+			}
+			case VertexFormat::OctahedralSNorm16x2:
+			{
+				if (accessor.componentNum < 3u)
+					return false;
+
+				for (uint32_t v = 0; v < vertexNum; ++v)
+				{
+					const Float2 octahedral = EncodeOctahedral(ReadFloat3(accessor, v));
+					const int16_t values[2]{ QuantizeSNorm16(octahedral.x), QuantizeSNorm16(octahedral.y) };
+
+					std::memcpy(dst + static_cast<size_t>(v) * formatSize, values, formatSize);
+				}
+
+				break;
+			}
+			case VertexFormat::Half2:
+			{
+				if (accessor.componentNum != 2u)
+					return false;
+
+				for (uint32_t v = 0; v < vertexNum; ++v)
+				{
+					const uint16_t values[2]{ FloatToHalf(ReadComponent(accessor, v, 0)), FloatToHalf(ReadComponent(accessor, v, 1)) };
+
+					std::memcpy(dst + static_cast<size_t>(v) * formatSize, values, formatSize);
+				}
+
+				break;
+			}
+			default:
+				return false;
+		}
+
+		dst += static_cast<size_t>(vertexNum) * formatSize;
+	}
+
+	return true;
+}
+
+void WriteGlbIndices(const GlbFileView& _view, void* _dst)
+{
+	uint8_t* dst = static_cast<uint8_t*>(_dst);
+
+	const bool b32Bits = _view.indexFormat == IndexFormat::UInt32;
+	const GlbComponentType dstType = b32Bits ? GlbComponentType::UInt32 : GlbComponentType::UInt16;
+	const uint32_t indexSize = GetIndexFormatSize(_view.indexFormat);
+
+	for (const GlbPrimitiveView& primitive : _view.primitives)
+	{
+		const uint32_t indexNum = GetIndexNum(primitive);
+
+		// Same format: single copy.
+		if (primitive.indices.data && primitive.indices.componentType == dstType && primitive.indices.IsTightlyPacked())
+			std::memcpy(dst, primitive.indices.data, static_cast<size_t>(indexNum) * indexSize);
+		else if (b32Bits)
+		{
+			for (uint32_t i = 0; i < indexNum; ++i)
+			{
+				const uint32_t index = ReadIndex(primitive.indices, i);
+				std::memcpy(dst + static_cast<size_t>(i) * indexSize, &index, indexSize);
+			}
+		}
+		else
+		{
+			// 16-bit format: every primitive has at most 65536 vertices.
+			for (uint32_t i = 0; i < indexNum; ++i)
+			{
+				const uint16_t index = static_cast<uint16_t>(ReadIndex(primitive.indices, i));
+				std::memcpy(dst + static_cast<size_t>(i) * indexSize, &index, indexSize);
+			}
+		}
+
+		dst += static_cast<size_t>(indexNum) * indexSize;
+	}
+}
+
+
+bool ImportGlb(const GlbFileView& _view, MeshData& _outMesh)
+{
+	for (const GlbPrimitiveView& primitive : _view.primitives)
+	{
+		if (!primitive.normals.data || !primitive.uvs.data)
+			return false;
+
+		const uint32_t vertexNum = primitive.positions.count;
+		const uint32_t indexNum = GetIndexNum(primitive);
+
+		MeshData submesh;
+		submesh.positions.resize(vertexNum);
+		submesh.normals.resize(vertexNum);
+		submesh.uvs.resize(vertexNum);
+		submesh.indices.resize(indexNum);
+
+		// Left-handed: mirror z. UV origin is already top-left.
+		for (uint32_t v = 0; v < vertexNum; ++v)
+		{
+			const Float3 position = ReadFloat3(primitive.positions, v);
+			const Float3 normal = ReadFloat3(primitive.normals, v);
+
+			submesh.positions[v] = Float3{ position.x, position.y, -position.z };
+			submesh.normals[v] = Float3{ normal.x, normal.y, -normal.z };
+			submesh.uvs[v] = Float2{ ReadComponent(primitive.uvs, v, 0), ReadComponent(primitive.uvs, v, 1) };
+		}
+
+		// Reversed winding: clockwise front faces. Indices are validated here only (the GPU tolerates out of range fetches).
+		for (uint32_t i = 0; i < indexNum; i += 3)
+		{
+			const uint32_t i0 = ReadIndex(primitive.indices, i);
+			const uint32_t i1 = ReadIndex(primitive.indices, i + 1);
+			const uint32_t i2 = ReadIndex(primitive.indices, i + 2);
+
+			if (i0 >= vertexNum || i1 >= vertexNum || i2 >= vertexNum)
+				return false;
+
+			submesh.indices[i] = i2;
+			submesh.indices[i + 1] = i1;
+			submesh.indices[i + 2] = i0;
+		}
+
+		AppendSubmesh(_outMesh, submesh);
+	}
+
+	return true;
+}
+
+bool LoadGlb(const char* _path, MeshData& _outMesh)
+{
+	MappedFile file;
+	GlbFileView view;
+
+	return file.Open(_path) && ParseGlb(file.GetData(), file.GetSize(), view) && ImportGlb(view, _outMesh);
+}
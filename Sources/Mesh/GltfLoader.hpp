@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Mesh/MeshFile.hpp"
+
+/**
+* Binary glTF 2.0 (.glb) loader.
+*
+* The file is memory-mapped and parsed into views: the JSON chunk is read with JsonDocument,
+* accessors point straight into the BIN chunk (no copy, no intermediate allocation).
+* Vertex streams and indices are then written directly into their destination (GPU staging memory at runtime):
+* accessors already in the Lit input layout format (tightly packed floats) are copied with a single memcpy,
+* others are converted element by element (quantization, strided / interleaved views, normalized UVs, 8-bit indices).
+*
+* Every triangle primitive of every mesh is a submesh. Node transforms, materials, sparse accessors and external buffers are not supported.
+* Streaming at runtime requires normals, tangents and UVs on every primitive (files without them are rejected):
+* tangents are only generated when cooking (see ImportGlb() and GenerateTangents()).
+* glTF data is right-handed (counter-clockwise front faces, UV origin top-left):
+* the runtime mirrors z in the object transform (front faces become clockwise, see ObjectUBO tangentHandedness),
+* ImportGlb() converts the data to left-handed instead.
+*/
+
+enum class GlbComponentType : uint32_t
+{
+	Int8 = 5120,
+	UInt8 = 5121,
+	Int16 = 5122,
+	UInt16 = 5123,
+	UInt32 = 5125,
+	Float = 5126,
+};
+
+/**
+* Accessor data in the BIN chunk.
+*/
+struct GlbAccessorView
+{
+	const uint8_t* data = nullptr;
+
+	uint32_t count = 0u;
+
+	GlbComponentType componentType = GlbComponentType::Float;
+	uint32_t componentNum = 0u;
+	bool bNormalized = false;
+
+	/// Bytes between elements (bufferView byteStride, element size if tightly packed).
+	uint32_t stride = 0u;
+
+	uint32_t GetElementSize() const;
+	bool IsTightlyPacked() const { return stride == GetElementSize(); }
+};
+
+struct GlbPrimitiveView
+{
+	GlbAccessorView positions;
+	GlbAccessorView normals;
+	GlbAccessorView tangents;
+	GlbAccessorView uvs;
+
+	/// Non-indexed primitives have a null indices.data (indices are generated).
+	GlbAccessorView indices;
+
+	/// POSITION accessor min / max, sphere around the box (no pass over positions).
+	MeshBounds bounds;
+	BoundingSphere sphere;
+};
+
+struct GlbFileView
+{
+	std::vector<GlbPrimitiveView> primitives;
+
+	uint32_t vertexNum = 0u;
+	uint32_t indexNum = 0u;
+
+	MeshBounds bounds;
+	BoundingSphere sphere;
+
+	/// Draw ranges of the primitives in the concatenated vertex / index buffers (no LODs, no meshlets).
+	std::vector<Submesh> submeshes;
+
+	/// Smallest index format for every primitive (indices are relative to the submesh baseVertex).
+	IndexFormat indexFormat = IndexFormat::UInt16;
+};
+
+/**
+* Parse a .glb file in memory (typically memory-mapped): _data must outlive _outView.
+* Every range is validated: malformed files are rejected.
+*/
+bool ParseGlb(const uint8_t* _data, uint64_t _size, GlbFileView& _outView);
+
+/**
+* Write the _semantic stream of every primitive in _format at _dst (vertexNum * GetVertexFormatSize(_format) bytes).
+* Quantized positions use _quantizationBounds (see ComputePositionDequantization), w stores the tangent handedness.
+* Return false if the stream is missing or its accessor type can't be converted to _format.
+*/
+bool WriteGlbVertexStream(const GlbFileView& _view, VertexSemantic _semantic, VertexFormat _format, const MeshBounds& _quantizationBounds, void* _dst);
+
+/**
+* Write the indices of every primitive in _view.indexFormat at _dst (indexNum * GetIndexFormatSize() bytes).
+*/
+void WriteGlbIndices(const GlbFileView& _view, void* _dst);
+
+
+/**
+* Import positions, normals and UVs as left-handed MeshData submeshes (z mirrored, winding reversed), for MeshCooker.
+* Tangents are not imported: see GenerateTangents().
+*/
+bool ImportGlb(const GlbFileView& _view, MeshData& _outMesh);
+
+/// Memory-map, parse and import a .glb file.
+bool LoadGlb(const char* _path, MeshData& _outMesh);
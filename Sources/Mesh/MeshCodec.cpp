@@ -0,0 +1,621 @@
+#include "Mesh/MeshCodec.hpp"
+
+#include "Core/ParallelFor.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+namespace
+{
+	/// Decoded vertex block size: the decode scratch buffer stays in L1 cache.
+	constexpr uint32_t vertexBlockBytes = 16384u;
+	constexpr uint32_t vertexGroupSize = 16u;
+	constexpr uint32_t maxVertexStride = vertexBlockBytes / vertexGroupSize;
+
+	/// Indices per block (whole triangles).
+	constexpr uint32_t indexBlockSize = 3u * 8192u;
+
+	/// Edge / vertex FIFO entries of the index codec (4-bit codes).
+	constexpr uint32_t fifoSize = 16u;
+
+	constexpr uint64_t blockTableHeaderSize = 8u;
+
+	/// Bits per value of each group header code.
+	constexpr uint32_t groupBits[4]{ 0u, 2u, 4u, 8u };
+
+
+	uint32_t GetVertexBlockSize(uint32_t _stride)
+	{
+		return (std::max)(vertexGroupSize, (vertexBlockBytes / _stride) / vertexGroupSize * vertexGroupSize);
+	}
+
+	uint32_t GetBlockNum(uint32_t _elementNum, uint32_t _blockSize)
+	{
+		return (_elementNum + _blockSize - 1) / _blockSize;
+	}
+
+//{ Block table
+
+	/**
+	* Write the block table header, then append each block (see EncodeBlock) and its end offset.
+	*/
+	template <typename EncodeBlockFuncT>
+	std::vector<uint8_t> EncodeBlocks(uint32_t _blockNum, EncodeBlockFuncT&& _encodeBlock)
+	{
+		std::vector<uint8_t> encoded(blockTableHeaderSize + _blockNum * sizeof(uint64_t));
+		std::memcpy(encoded.data(), &_blockNum, sizeof(uint32_t));
+
+		for (uint32_t b = 0; b < _blockNum; ++b)
+		{
+			_encodeBlock(b, encoded);
+
+			const uint64_t blockEnd = encoded.size();
+			std::memcpy(encoded.data() + blockTableHeaderSize + b * sizeof(uint64_t), &blockEnd, sizeof(uint64_t));
+		}
+
+		return encoded;
+	}
+
+	/**
+	* Validate the block table and decode every block in parallel.
+	* _decodeBlock(blockIndex, begin, end) returns false on corrupted data.
+	*/
+	template <typename DecodeBlockFuncT>
+	bool DecodeBlocks(const uint8_t* _encoded, uint64_t _encodedSize, uint32_t _blockNum, DecodeBlockFuncT&& _decodeBlock)
+	{
+		const uint64_t tableEnd = blockTableHeaderSize + static_cast<uint64_t>(_blockNum) * sizeof(uint64_t);
+
+		if (_encodedSize < tableEnd)
+			return false;
+
+		uint32_t blockNum = 0u;
+		std::memcpy(&blockNum, _encoded, sizeof(uint32_t));
+
+		if (blockNum != _blockNum)
+			return false;
+
+		std::vector<uint64_t> blockEnds(_blockNum);
+		std::memcpy(blockEnds.data(), _encoded + blockTableHeaderSize, _blockNum * sizeof(uint64_t));
+
+		for (uint32_t b = 0; b < _blockNum; ++b)
+		{
+			const uint64_t blockBegin = b ? blockEnds[b - 1] : tableEnd;
+
+			if (blockEnds[b] < blockBegin || blockEnds[b] > _encodedSize)
+				return false;
+		}
+
+		std::atomic<bool> bValid = true;
+
+		ParallelFor(_blockNum, [&](uint32_t _blockIndex)
+		{
+			const uint8_t* const begin = _encoded + (_blockIndex ? blockEnds[_blockIndex - 1] : tableEnd);
+			const uint8_t* const end = _encoded + blockEnds[_blockIndex];
+
+			if (!_decodeBlock(_blockIndex, begin, end))
+				bValid = false;
+		});
+
+		return bValid;
+	}
+
+//}
+
+
+//{ Vertex codec
+
+	uint8_t ZigzagEncode8(uint8_t _delta)
+	{
+		return static_cast<uint8_t>((_delta << 1) ^ static_cast<uint8_t>(static_cast<int8_t>(_delta) >> 7));
+	}
+
+	uint8_t ZigzagDecode8(uint8_t _value)
+	{
+		return static_cast<uint8_t>((_value >> 1) ^ static_cast<uint8_t>(-static_cast<int32_t>(_value & 1u)));
+	}
+
+	/**
+	* Size of a group packed with _bits per value: values >= the sentinel (all bits set) are exceptions,
+	* stored as raw bytes after the group.
+	*/
+	uint32_t GetGroupSize(const uint8_t* _values, uint32_t _bits)
+	{
+		if (_bits == 0u || _bits == 8u)
+			return _bits * vertexGroupSize / 8;
+
+		const uint32_t sentinel = (1u << _bits) - 1u;
+		uint32_t size = _bits * vertexGroupSize / 8;
+
+		for (uint32_t j = 0; j < vertexGroupSize; ++j)
+			size += _values[j] >= sentinel;
+
+		return size;
+	}
+
+	void EncodeVertexBlock(const uint8_t* _vertices, uint32_t _vertexNum, uint32_t _stride, std::vector<uint8_t>& _out)
+	{
+		const uint32_t groupNum = GetBlockNum(_vertexNum, vertexGroupSize);
+
+		for (uint32_t k = 0; k < _stride; ++k)
+		{
+			// 4 group headers (2 bits each) per byte, then group data.
+			const size_t headerOffset = _out.size();
+			_out.resize(headerOffset + (groupNum + 3) / 4, 0u);
+
+			uint8_t previous = 0u;
+
+			for (uint32_t g = 0; g < groupNum; ++g)
+			{
+				uint8_t values[vertexGroupSize]{};
+				uint8_t valueMask = 0u;
+
+				for (uint32_t j = 0; j < vertexGroupSize && g * vertexGroupSize + j < _vertexNum; ++j)
+				{
+					const uint8_t value = _vertices[static_cast<size_t>(g * vertexGroupSize + j) * _stride + k];
+
+					values[j] = ZigzagEncode8(static_cast<uint8_t>(value - previous));
+					valueMask |= values[j];
+
+					previous = value;
+				}
+
+				// Smallest encoding: a few large deltas don't force the whole group to 8 bits.
+				uint32_t code = 0u;
+
+				if (valueMask != 0u)
+				{
+					code = 3u;
+
+					for (uint32_t c = 1u; c < 3u; ++c)
+					{
+						if (GetGroupSize(values, groupBits[c]) < GetGroupSize(values, groupBits[code]))
+							code = c;
+					}
+				}
+
+				const uint32_t bits = groupBits[code];
+				const uint32_t sentinel = (1u << bits) - 1u;
+
+				_out[headerOffset + g / 4] |= static_cast<uint8_t>(code << ((g % 4) * 2));
+
+				// Pack 8 / bits values per byte, first value in the low bits.
+				for (uint32_t j = 0; j < vertexGroupSize && bits; j += 8 / bits)
+				{
+					uint8_t packed = 0u;
+
+					for (uint32_t p = 0; p < 8 / bits; ++p)
+						packed |= static_cast<uint8_t>((std::min)(static_cast<uint32_t>(values[j + p]), sentinel) << (p * bits));
+
+					_out.push_back(packed);
+				}
+
+				if (bits == 2u || bits == 4u)
+				{
+					for (uint32_t j = 0; j < vertexGroupSize; ++j)
+					{
+						if (values[j] >= sentinel)
+							_out.push_back(values[j]);
+					}
+				}
+			}
+		}
+	}
+
+	bool DecodeVertexBlock(const uint8_t* _begin, const uint8_t* _end, uint32_t _vertexNum, uint32_t _stride, uint8_t* _dst)
+	{
+		// Scratch block: byte lanes are scattered here, then the destination is written once, sequentially.
+		alignas(16) uint8_t block[vertexBlockBytes];
+
+		const uint32_t groupNum = GetBlockNum(_vertexNum, vertexGroupSize);
+		const uint32_t headerSize = (groupNum + 3) / 4;
+
+		const uint8_t* data = _begin;
+
+		for (uint32_t k = 0; k < _stride; ++k)
+		{
+			if (static_cast<size_t>(_end - data) < headerSize)
+				return false;
+
+			const uint8_t* const headers = data;
+			data += headerSize;
+
+			uint8_t previous = 0u;
+
+			for (uint32_t g = 0; g < groupNum; ++g)
+			{
+				const uint32_t bits = groupBits[(headers[g / 4] >> ((g % 4) * 2)) & 3u];
+				const uint32_t groupBytes = bits * vertexGroupSize / 8;
+
+				if (static_cast<size_t>(_end - data) < groupBytes)
+					return false;
+
+				uint8_t values[vertexGroupSize]{};
+
+				if (bits == 8u)
+				{
+					std::memcpy(values, data, vertexGroupSize);
+					data += groupBytes;
+				}
+				else if (bits)
+				{
+					const uint32_t sentinel = (1u << bits) - 1u;
+					const uint8_t* const packed = data;
+
+					data += groupBytes;
+
+					for (uint32_t j = 0; j < vertexGroupSize; ++j)
+					{
+						values[j] = static_cast<uint8_t>((packed[j * bits / 8] >> ((j * bits) % 8)) & sentinel);
+
+						// Exception: raw value after the group.
+						if (values[j] == sentinel)
+						{
+							if (data == _end)
+								return false;
+
+							values[j] = *data++;
+						}
+					}
+				}
+
+				const uint32_t groupVertexNum = (std::min)(vertexGroupSize, _vertexNum - g * vertexGroupSize);
+
+				for (uint32_t j = 0; j < groupVertexNum; ++j)
+				{
+					previous = static_cast<uint8_t>(previous + ZigzagDecode8(values[j]));
+					block[(g * vertexGroupSize + j) * _stride + k] = previous;
+				}
+			}
+		}
+
+		std::memcpy(_dst, block, static_cast<size_t>(_vertexNum) * _stride);
+
+		return data == _end;
+	}
+
+//}
+
+
+//{ Index codec
+
+	void WriteVarint(uint32_t _value, std::vector<uint8_t>& _out)
+	{
+		while (_value >= 0x80u)
+		{
+			_out.push_back(static_cast<uint8_t>(_value | 0x80u));
+			_value >>= 7;
+		}
+
+		_out.push_back(static_cast<uint8_t>(_value));
+	}
+
+	bool ReadVarint(const uint8_t*& _data, const uint8_t* _end, uint32_t& _value)
+	{
+		_value = 0u;
+
+		for (uint32_t shift = 0; shift < 35; shift += 7)
+		{
+			if (_data >= _end)
+				return false;
+
+			const uint8_t byte = *_data++;
+			_value |= static_cast<uint32_t>(byte & 0x7Fu) << shift;
+
+			if (!(byte & 0x80u))
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	* Shared encoder / decoder state of a triangle block (see EncodeIndexBlock()).
+	* Both FIFOs are reset per block: blocks are independent.
+	*/
+	struct TriangleCodecState
+	{
+		/// Edges of the last triangles, as seen from the adjacent triangle (reversed winding).
+		uint32_t edges[fifoSize][2];
+		uint32_t edgeOffset = 0u;
+
+		/// Last vertices, referenced by the third vertex of an edge triangle.
+		uint32_t vertices[fifoSize];
+		uint32_t vertexOffset = 0u;
+
+		/// Next vertex never referenced yet: vertices in first-use order cost no extra byte.
+		uint32_t next = 0u;
+
+		/// Last free index: free indices are stored as a delta.
+		uint32_t last = 0u;
+
+		TriangleCodecState(uint32_t _emptyValue)
+		{
+			std::fill(&edges[0][0], &edges[0][0] + fifoSize * 2, _emptyValue);
+			std::fill(vertices, vertices + fifoSize, _emptyValue);
+		}
+
+		void PushEdge(uint32_t _a, uint32_t _b)
+		{
+			edges[edgeOffset][0] = _a;
+			edges[edgeOffset][1] = _b;
+			edgeOffset = (edgeOffset + 1) % fifoSize;
+		}
+
+		void PushVertex(uint32_t _vertex)
+		{
+			vertices[vertexOffset] = _vertex;
+			vertexOffset = (vertexOffset + 1) % fifoSize;
+		}
+
+		/// Entry _age (0 = most recent) of a FIFO.
+		uint32_t GetEntry(uint32_t _offset, uint32_t _age) const
+		{
+			return (_offset + fifoSize - 1 - _age) % fifoSize;
+		}
+	};
+
+	/**
+	* One code byte per triangle (high nibble: edge FIFO entry, low nibble: third vertex), then free indices (varints).
+	*   - edge triangle (high < 15): 2 vertices from an edge of a previous triangle, third vertex is
+	*     next (0), a vertex FIFO entry (1 to 14) or a free index (15).
+	*   - other triangles (high = 15): low bit i set when vertex i is next, otherwise a free index.
+	* Triangles are rotated to start with the shared edge (winding kept).
+	*/
+	void EncodeIndexBlock(const uint32_t* _indices, uint32_t _triangleNum, std::vector<uint8_t>& _out)
+	{
+		TriangleCodecState state(~0u);
+
+		std::vector<uint8_t> freeIndices;
+
+		auto WriteFree = [&](uint32_t _index)
+		{
+			const uint32_t delta = _index - state.last;
+			WriteVarint((delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31), freeIndices);
+
+			state.last = _index;
+
+			if (_index >= state.next)
+				state.next = _index + 1;
+		};
+
+		for (uint32_t t = 0; t < _triangleNum; ++t)
+		{
+			const uint32_t* const triangle = _indices + t * 3;
+
+			uint32_t edge = fifoSize;
+			uint32_t rotation = 0u;
+
+			for (; rotation < 3u && edge == fifoSize; ++rotation)
+			{
+				const uint32_t a = triangle[rotation];
+				const uint32_t b = triangle[(rotation + 1) % 3];
+
+				for (uint32_t e = 0; e < fifoSize - 1 && edge == fifoSize; ++e)
+				{
+					const uint32_t* const entry = state.edges[state.GetEntry(state.edgeOffset, e)];
+
+					if (entry[0] == a && entry[1] == b)
+						edge = e;
+				}
+			}
+
+			if (edge != fifoSize)
+			{
+				--rotation;
+
+				const uint32_t a = triangle[rotation];
+				const uint32_t b = triangle[(rotation + 1) % 3];
+				const uint32_t c = triangle[(rotation + 2) % 3];
+
+				uint32_t code = fifoSize - 1;
+
+				if (c == state.next)
+				{
+					code = 0u;
+					++state.next;
+					state.PushVertex(c);
+				}
+				else
+				{
+					for (uint32_t v = 0; v < fifoSize - 2 && code == fifoSize - 1; ++v)
+					{
+						if (state.vertices[state.GetEntry(state.vertexOffset, v)] == c)
+							code = v + 1;
+					}
+
+					if (code == fifoSize - 1)
+					{
+						WriteFree(c);
+						state.PushVertex(c);
+					}
+				}
+
+				_out.push_back(static_cast<uint8_t>((edge << 4) | code));
+
+				state.PushEdge(c, b);
+				state.PushEdge(a, c);
+			}
+			else
+			{
+				uint32_t code = 0u;
+
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					if (triangle[i] == state.next)
+					{
+						code |= 1u << i;
+						++state.next;
+					}
+					else
+						WriteFree(triangle[i]);
+
+					state.PushVertex(triangle[i]);
+				}
+
+				_out.push_back(static_cast<uint8_t>(((fifoSize - 1) << 4) | code));
+
+				state.PushEdge(triangle[1], triangle[0]);
+				state.PushEdge(triangle[2], triangle[1]);
+				state.PushEdge(triangle[0], triangle[2]);
+			}
+		}
+
+		_out.insert(_out.end(), freeIndices.begin(), freeIndices.end());
+	}
+
+	template <typename IndexT>
+	bool DecodeIndexBlock(const uint8_t* _begin, const uint8_t* _end, uint32_t _triangleNum, IndexT* _dst)
+	{
+		if (static_cast<size_t>(_end - _begin) < _triangleNum)
+			return false;
+
+		TriangleCodecState state(0u);
+
+		const uint8_t* const codes = _begin;
+		const uint8_t* data = _begin + _triangleNum;
+
+		auto ReadFree = [&](uint32_t& _index)
+		{
+			uint32_t value = 0u;
+
+			if (!ReadVarint(data, _end, value))
+				return false;
+
+			_index = state.last + ((value >> 1) ^ (0u - (value & 1u)));
+			state.last = _index;
+
+			if (_index >= state.next)
+				state.next = _index + 1;
+
+			return true;
+		};
+
+		for (uint32_t t = 0; t < _triangleNum; ++t)
+		{
+			const uint32_t edge = codes[t] >> 4;
+			const uint32_t code = codes[t] & 0xFu;
+
+			uint32_t a;
+			uint32_t b;
+			uint32_t c;
+
+			if (edge != fifoSize - 1)
+			{
+				const uint32_t* const entry = state.edges[state.GetEntry(state.edgeOffset, edge)];
+				a = entry[0];
+				b = entry[1];
+
+				if (code == 0u)
+				{
+					c = state.next++;
+					state.PushVertex(c);
+				}
+				else if (code < fifoSize - 1)
+					c = state.vertices[state.GetEntry(state.vertexOffset, code - 1)];
+				else
+				{
+					if (!ReadFree(c))
+						return false;
+
+					state.PushVertex(c);
+				}
+
+				state.PushEdge(c, b);
+				state.PushEdge(a, c);
+			}
+			else
+			{
+				uint32_t triangle[3];
+
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					if (code & (1u << i))
+						triangle[i] = state.next++;
+					else if (!ReadFree(triangle[i]))
+						return false;
+
+					state.PushVertex(triangle[i]);
+				}
+
+				a = triangle[0];
+				b = triangle[1];
+				c = triangle[2];
+
+				state.PushEdge(b, a);
+				state.PushEdge(c, b);
+				state.PushEdge(a, c);
+			}
+
+			_dst[t * 3] = static_cast<IndexT>(a);
+			_dst[t * 3 + 1] = static_cast<IndexT>(b);
+			_dst[t * 3 + 2] = static_cast<IndexT>(c);
+		}
+
+		return data == _end;
+	}
+
+//}
+}
+
+
+std::vector<uint8_t> EncodeVertexBuffer(const uint8_t* _vertices, uint32_t _vertexNum, uint32_t _stride)
+{
+	if (_stride == 0u || _stride > maxVertexStride)
+		return {};
+
+	const uint32_t blockSize = GetVertexBlockSize(_stride);
+
+	return EncodeBlocks(GetBlockNum(_vertexNum, blockSize), [&](uint32_t _blockIndex, std::vector<uint8_t>& _out)
+	{
+		const uint32_t first = _blockIndex * blockSize;
+
+		EncodeVertexBlock(_vertices + static_cast<size_t>(first) * _stride, (std::min)(blockSize, _vertexNum - first), _stride, _out);
+	});
+}
+
+bool DecodeVertexBuffer(const uint8_t* _encoded, uint64_t _encodedSize, uint32_t _vertexNum, uint32_t _stride, void* _dst)
+{
+	if (_stride == 0u || _stride > maxVertexStride)
+		return false;
+
+	const uint32_t blockSize = GetVertexBlockSize(_stride);
+	uint8_t* const dst = static_cast<uint8_t*>(_dst);
+
+	return DecodeBlocks(_encoded, _encodedSize, GetBlockNum(_vertexNum, blockSize), [&](uint32_t _blockIndex, const uint8_t* _begin, const uint8_t* _end)
+	{
+		const uint32_t first = _blockIndex * blockSize;
+
+		return DecodeVertexBlock(_begin, _end, (std::min)(blockSize, _vertexNum - first), _stride, dst + static_cast<size_t>(first) * _stride);
+	});
+}
+
+
+std::vector<uint8_t> EncodeIndexBuffer(const uint32_t* _indices, uint32_t _indexNum)
+{
+	if (_indexNum % 3)
+		return {};
+
+	return EncodeBlocks(GetBlockNum(_indexNum, indexBlockSize), [&](uint32_t _blockIndex, std::vector<uint8_t>& _out)
+	{
+		const uint32_t first = _blockIndex * indexBlockSize;
+
+		EncodeIndexBlock(_indices + first, (std::min)(indexBlockSize, _indexNum - first) / 3, _out);
+	});
+}
+
+bool DecodeIndexBuffer(const uint8_t* _encoded, uint64_t _encodedSize, uint32_t _indexNum, uint32_t _indexSize, void* _dst)
+{
+	if ((_indexSize != sizeof(uint16_t) && _indexSize != sizeof(uint32_t)) || _indexNum % 3)
+		return false;
+
+	return DecodeBlocks(_encoded, _encodedSize, GetBlockNum(_indexNum, indexBlockSize), [&](uint32_t _blockIndex, const uint8_t* _begin, const uint8_t* _end)
+	{
+		const uint32_t first = _blockIndex * indexBlockSize;
+		const uint32_t triangleNum = (std::min)(indexBlockSize, _indexNum - first) / 3;
+
+		if (_indexSize == sizeof(uint16_t))
+			return DecodeIndexBlock(_begin, _end, triangleNum, static_cast<uint16_t*>(_dst) + first);
+
+		return DecodeIndexBlock(_begin, _end, triangleNum, static_cast<uint32_t*>(_dst) + first);
+	});
+}
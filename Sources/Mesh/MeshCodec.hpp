@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+/**
+* Lossless vertex / index buffer compression for cooked meshes (meshoptimizer-style codecs).
+* Fast to decode: byte-oriented, no entropy coder (files can still be zipped by the installer).
+*
+* Encoded buffers are split in independent blocks decoded in parallel (see ParallelFor),
+* each block is written once, sequentially, to its destination: decode straight into GPU staging (write-combined) memory.
+* Layout: uint32 blockNum, uint32 reserved, uint64 block end offsets[blockNum] (from the buffer start), blocks data.
+*
+* Vertex codec: per block and per byte of the vertex (bytes of a same attribute component are similar),
+* delta from the previous vertex, zigzag encoded, bit-packed by groups of 16 with 0, 2, 4 or 8 bits per value.
+* 2 and 4-bit groups have exceptions: values that don't fit are stored as raw bytes after the group.
+* Best after OptimizeVertexFetch() (neighbor vertices are close).
+*
+* Index codec (triangle lists): one code byte per triangle, referencing an edge of a previous triangle (16-entry edge FIFO)
+* and its third vertex as the next unused vertex, a recent vertex (16-entry vertex FIFO) or a free index (zigzag varint delta).
+* Most triangles of a mesh cost a single byte. Triangles may be rotated (winding kept).
+* Best after OptimizeVertexCache() / OptimizeVertexFetch() (adjacent triangles, vertices in first-use order).
+*/
+
+std::vector<uint8_t> EncodeVertexBuffer(const uint8_t* _vertices, uint32_t _vertexNum, uint32_t _stride);
+
+/**
+* Decode _vertexNum vertices of _stride bytes at _dst.
+* Return false on corrupted data (_dst content is undefined).
+*/
+bool DecodeVertexBuffer(const uint8_t* _encoded, uint64_t _encodedSize, uint32_t _vertexNum, uint32_t _stride, void* _dst);
+
+
+/// _indexNum: triangle list (multiple of 3), otherwise return an empty buffer.
+std::vector<uint8_t> EncodeIndexBuffer(const uint32_t* _indices, uint32_t _indexNum);
+
+/**
+* Decode _indexNum indices of _indexSize bytes (2 or 4) at _dst.
+* Return false on corrupted data (_dst content is undefined).
+*/
+bool DecodeIndexBuffer(const uint8_t* _encoded, uint64_t _encodedSize, uint32_t _indexNum, uint32_t _indexSize, void* _dst);
@@ -0,0 +1,252 @@
+#include "Mesh/MeshData.hpp"
+
+#include "Core/CPUFeatures.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+	float SquaredDistance(const Float3& _lhs, const Float3& _rhs)
+	{
+		const float dx = _lhs.x - _rhs.x;
+		const float dy = _lhs.y - _rhs.y;
+		const float dz = _lhs.z - _rhs.z;
+
+		return dx * dx + dy * dy + dz * dz;
+	}
+}
+
+MeshBounds ComputeBounds(const Float3* _positions, uint32_t _positionNum)
+{
+	if (_positionNum == 0u)
+		return MeshBounds{};
+
+	const float* const coords = &_positions[0].x;
+
+	/**
+	* 4 positions (12 floats) = 3 registers per iteration, without shuffles:
+	* lanes hold (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3), reduced per axis after the loop.
+	*/
+	// Start from the first position, with the lane axes of a block.
+	__m128 min0 = _mm_setr_ps(coords[0], coords[1], coords[2], coords[0]);
+	__m128 min1 = _mm_setr_ps(coords[1], coords[2], coords[0], coords[1]);
+	__m128 min2 = _mm_setr_ps(coords[2], coords[0], coords[1], coords[2]);
+	__m128 max0 = min0;
+	__m128 max1 = min1;
+	__m128 max2 = min2;
+
+	const uint32_t blockNum = _positionNum / 4u;
+
+	for (uint32_t i = 0; i < blockNum; ++i)
+	{
+		const float* const block = coords + i * 12u;
+
+		const __m128 v0 = _mm_loadu_ps(block);
+		const __m128 v1 = _mm_loadu_ps(block + 4);
+		const __m128 v2 = _mm_loadu_ps(block + 8);
+
+		min0 = _mm_min_ps(min0, v0);
+		min1 = _mm_min_ps(min1, v1);
+		min2 = _mm_min_ps(min2, v2);
+
+		max0 = _mm_max_ps(max0, v0);
+		max1 = _mm_max_ps(max1, v1);
+		max2 = _mm_max_ps(max2, v2);
+	}
+
+	alignas(16) float mins[12];
+	alignas(16) float maxs[12];
+
+	_mm_store_ps(mins, min0);
+	_mm_store_ps(mins + 4, min1);
+	_mm_store_ps(mins + 8, min2);
+	_mm_store_ps(maxs, max0);
+	_mm_store_ps(maxs + 4, max1);
+	_mm_store_ps(maxs + 8, max2);
+
+	// Float i of a block is axis i % 3.
+	MeshBounds bounds{
+		.min = _positions[0],
+		.max = _positions[0],
+	};
+
+	for (uint32_t i = 0; i < 12u; i += 3u)
+	{
+		bounds.min.x = (std::min)(bounds.min.x, mins[i]);
+		bounds.min.y = (std::min)(bounds.min.y, mins[i + 1]);
+		bounds.min.z = (std::min)(bounds.min.z, mins[i + 2]);
+
+		bounds.max.x = (std::max)(bounds.max.x, maxs[i]);
+		bounds.max.y = (std::max)(bounds.max.y, maxs[i + 1]);
+		bounds.max.z = (std::max)(bounds.max.z, maxs[i + 2]);
+	}
+
+	for (uint32_t i = blockNum * 4u; i < _positionNum; ++i)
+	{
+		const Float3& position = _positions[i];
+
+		bounds.min.x = (std::min)(bounds.min.x, position.x);
+		bounds.min.y = (std::min)(bounds.min.y, position.y);
+		bounds.min.z = (std::min)(bounds.min.z, position.z);
+
+		bounds.max.x = (std::max)(bounds.max.x, position.x);
+		bounds.max.y = (std::max)(bounds.max.y, position.y);
+		bounds.max.z = (std::max)(bounds.max.z, position.z);
+	}
+
+	return bounds;
+}
+
+BoundingSphere ComputeBoundingSphere(const Float3* _positions, uint32_t _positionNum, const MeshBounds& _bounds)
+{
+	if (_positionNum == 0u)
+		return BoundingSphere{};
+
+	// Extreme points along each axis.
+	uint32_t minIndices[3] = { 0u, 0u, 0u };
+	uint32_t maxIndices[3] = { 0u, 0u, 0u };
+
+	for (uint32_t i = 1; i < _positionNum; ++i)
+	{
+		const float* const position = &_positions[i].x;
+
+		for (uint32_t axis = 0; axis < 3u; ++axis)
+		{
+			if (position[axis] < (&_positions[minIndices[axis]].x)[axis])
+				minIndices[axis] = i;
+
+			if (position[axis] > (&_positions[maxIndices[axis]].x)[axis])
+				maxIndices[axis] = i;
+		}
+	}
+
+	// Initial sphere on the most distant pair.
+	uint32_t pairAxis = 0u;
+	float pairSquaredDistance = -1.0f;
+
+	for (uint32_t axis = 0; axis < 3u; ++axis)
+	{
+		const float squaredDistance = SquaredDistance(_positions[minIndices[axis]], _positions[maxIndices[axis]]);
+
+		if (squaredDistance > pairSquaredDistance)
+		{
+			pairAxis = axis;
+			pairSquaredDistance = squaredDistance;
+		}
+	}
+
+	const Float3& pairMin = _positions[minIndices[pairAxis]];
+	const Float3& pairMax = _positions[maxIndices[pairAxis]];
+
+	BoundingSphere ritter{
+		.center = Float3{ (pairMin.x + pairMax.x) * 0.5f, (pairMin.y + pairMax.y) * 0.5f, (pairMin.z + pairMax.z) * 0.5f },
+		.radius = std::sqrt(pairSquaredDistance) * 0.5f,
+	};
+
+	// Grow the sphere toward every outside position (keeps the opposite side fixed).
+	for (uint32_t i = 0; i < _positionNum; ++i)
+	{
+		const Float3& position = _positions[i];
+		const float squaredDistance = SquaredDistance(position, ritter.center);
+
+		if (squaredDistance <= ritter.radius * ritter.radius)
+			continue;
+
+		const float distance = std::sqrt(squaredDistance);
+		const float radius = (ritter.radius + distance) * 0.5f;
+		const float shift = (radius - ritter.radius) / distance;
+
+		ritter.center = Float3{
+			ritter.center.x + (position.x - ritter.center.x) * shift,
+			ritter.center.y + (position.y - ritter.center.y) * shift,
+			ritter.center.z + (position.z - ritter.center.z) * shift,
+		};
+		ritter.radius = radius;
+	}
+
+	// Exact radii around both centers: float rounding while growing can leave positions slightly outside.
+	const Float3 boxCenter{ (_bounds.min.x + _bounds.max.x) * 0.5f, (_bounds.min.y + _bounds.max.y) * 0.5f, (_bounds.min.z + _bounds.max.z) * 0.5f };
+
+	float ritterSquaredRadius = 0.0f;
+	float boxSquaredRadius = 0.0f;
+
+	for (uint32_t i = 0; i < _positionNum; ++i)
+	{
+		ritterSquaredRadius = (std::max)(ritterSquaredRadius, SquaredDistance(_positions[i], ritter.center));
+		boxSquaredRadius = (std::max)(boxSquaredRadius, SquaredDistance(_positions[i], boxCenter));
+	}
+
+	if (boxSquaredRadius < ritterSquaredRadius)
+		return BoundingSphere{ .center = boxCenter, .radius = std::sqrt(boxSquaredRadius) };
+
+	return BoundingSphere{ .center = ritter.center, .radius = std::sqrt(ritterSquaredRadius) };
+}
+
+BoundingSphere ComputeBoundingSphere(const MeshBounds& _bounds)
+{
+	const Float3 center{ (_bounds.min.x + _bounds.max.x) * 0.5f, (_bounds.min.y + _bounds.max.y) * 0.5f, (_bounds.min.z + _bounds.max.z) * 0.5f };
+
+	return BoundingSphere{
+		.center = center,
+		.radius = std::sqrt(SquaredDistance(_bounds.max, center)),
+	};
+}
+
+void ComputeMeshBounds(MeshData& _mesh)
+{
+	for (Submesh& submesh : _mesh.submeshes)
+	{
+		const Float3* const positions = _mesh.positions.data() + submesh.baseVertex;
+
+		submesh.bounds = ComputeBounds(positions, submesh.vertexNum);
+		submesh.sphere = ComputeBoundingSphere(positions, submesh.vertexNum, submesh.bounds);
+	}
+
+	const uint32_t positionNum = static_cast<uint32_t>(_mesh.positions.size());
+
+	_mesh.bounds = ComputeBounds(_mesh.positions.data(), positionNum);
+	_mesh.sphere = ComputeBoundingSphere(_mesh.positions.data(), positionNum, _mesh.bounds);
+}
+
+MeshData ExtractSubmesh(const MeshData& _mesh, const Submesh& _submesh)
+{
+	MeshData result;
+
+	auto copyRange = [](const auto& _source, auto& _destination, uint32_t _offset, uint32_t _num)
+	{
+		_destination.assign(_source.begin() + _offset, _source.begin() + _offset + _num);
+	};
+
+	copyRange(_mesh.positions, result.positions, _submesh.baseVertex, _submesh.vertexNum);
+	copyRange(_mesh.normals, result.normals, _submesh.baseVertex, _submesh.vertexNum);
+	copyRange(_mesh.uvs, result.uvs, _submesh.baseVertex, _submesh.vertexNum);
+	copyRange(_mesh.indices, result.indices, _submesh.indexOffset, _submesh.indexNum);
+
+	if (_mesh.tangents.size() == _mesh.positions.size())
+		copyRange(_mesh.tangents, result.tangents, _submesh.baseVertex, _submesh.vertexNum);
+
+	result.bounds = _submesh.bounds;
+	result.sphere = _submesh.sphere;
+
+	return result;
+}
+
+void AppendSubmesh(MeshData& _mesh, const MeshData& _submesh)
+{
+	_mesh.submeshes.push_back(Submesh{
+		.indexOffset = static_cast<uint32_t>(_mesh.indices.size()),
+		.indexNum = static_cast<uint32_t>(_submesh.indices.size()),
+		.baseVertex = static_cast<uint32_t>(_mesh.positions.size()),
+		.vertexNum = static_cast<uint32_t>(_submesh.positions.size()),
+		.bounds = _submesh.bounds,
+		.sphere = _submesh.sphere,
+	});
+
+	_mesh.positions.insert(_mesh.positions.end(), _submesh.positions.begin(), _submesh.positions.end());
+	_mesh.normals.insert(_mesh.normals.end(), _submesh.normals.begin(), _submesh.normals.end());
+	_mesh.tangents.insert(_mesh.tangents.end(), _submesh.tangents.begin(), _submesh.tangents.end());
+	_mesh.uvs.insert(_mesh.uvs.end(), _submesh.uvs.begin(), _submesh.uvs.end());
+
+	_mesh.indices.insert(_mesh.indices.end(), _submesh.indices.begin(), _submesh.indices.end());
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+/**
+* CPU-side editable mesh, used by the import / cook pipeline.
+* One vector per vertex attribute (same layout as the Lit vertex streams).
+* No maths library dependency: tools and runtime share these plain types.
+*/
+
+struct Float2
+{
+	float x = 0.0f;
+	float y = 0.0f;
+};
+
+struct Float3
+{
+	float x = 0.0f;
+	float y = 0.0f;
+	float z = 0.0f;
+};
+
+struct Float4
+{
+	float x = 0.0f;
+	float y = 0.0f;
+	float z = 0.0f;
+	float w = 0.0f;
+};
+
+struct MeshBounds
+{
+	Float3 min;
+	Float3 max;
+};
+
+struct BoundingSphere
+{
+	Float3 center;
+	float radius = 0.0f;
+};
+
+/**
+* Draw range in the mesh index and vertex buffers.
+* Indices are relative to baseVertex (DrawIndexedInstanced BaseVertexLocation):
+* 16-bit indices stay usable as long as each submesh has at most 65536 vertices.
+*/
+struct Submesh
+{
+	uint32_t indexOffset = 0u;
+	uint32_t indexNum = 0u;
+
+	uint32_t baseVertex = 0u;
+	uint32_t vertexNum = 0u;
+
+	// Range in MeshData::meshlets.
+	uint32_t meshletOffset = 0u;
+	uint32_t meshletNum = 0u;
+
+	// Range in MeshData::lods: simplified levels, from finest to coarsest (the submesh itself is LOD 0).
+	uint32_t lodOffset = 0u;
+	uint32_t lodNum = 0u;
+
+	MeshBounds bounds;
+	BoundingSphere sphere;
+};
+
+/**
+* Simplified level of detail of a submesh (see MeshSimplifier.hpp).
+* Same vertices as the submesh (indices relative to its baseVertex), own range in MeshData::indices.
+*/
+struct MeshLOD
+{
+	uint32_t indexOffset = 0u;
+	uint32_t indexNum = 0u;
+
+	/// Geometric error in mesh units (distance from the original surface), used for screen-space LOD selection.
+	float error = 0.0f;
+};
+
+/**
+* Cluster of at most meshletMaxVertices vertices / meshletMaxTriangles triangles (see Meshlet.hpp).
+* Triangles of a meshlet are a contiguous range of the mesh index buffer:
+* first index = triangleOffset * 3, so meshlets can be drawn with DrawIndexedInstanced as well as from a mesh shader.
+*/
+struct Meshlet
+{
+	// Range in MeshData::meshletVertices (vertex indices relative to the submesh baseVertex).
+	uint32_t vertexOffset = 0u;
+	uint32_t vertexNum = 0u;
+
+	// Range in MeshData::meshletTriangles.
+	uint32_t triangleOffset = 0u;
+	uint32_t triangleNum = 0u;
+
+	// Bounding sphere.
+	Float3 center;
+	float radius = 0.0f;
+
+	/**
+	* Normal cone: every triangle faces away from a viewer inside the cone (see IsMeshletBackfacing()).
+	* coneCutoff = 1 disables backface culling (normals too spread).
+	*/
+	Float3 coneAxis;
+	float coneCutoff = 1.0f;
+};
+
+struct MeshData
+{
+	std::vector<Float3> positions;
+	std::vector<Float3> normals;
+	// w: handedness (+1 / -1), bitangent = w * cross(normal, tangent).
+	std::vector<Float4> tangents;
+	std::vector<Float2> uvs;
+
+	// Triangle list, relative to each submesh baseVertex: submeshes first, then LODs.
+	std::vector<uint32_t> indices;
+
+	std::vector<Submesh> submeshes;
+	std::vector<MeshLOD> lods;
+
+	std::vector<Meshlet> meshlets;
+	std::vector<uint32_t> meshletVertices;
+
+	// Meshlet-local indices packed in 10:10:10 bits (mesh shader primitive indices layout).
+	std::vector<uint32_t> meshletTriangles;
+
+	MeshBounds bounds;
+	BoundingSphere sphere;
+};
+
+
+/// Axis-aligned bounds of _positionNum positions (SSE min / max reduction).
+MeshBounds ComputeBounds(const Float3* _positions, uint32_t _positionNum);
+
+/**
+* Bounding sphere of _positionNum positions contained in _bounds (see ComputeBounds()).
+* Ritter's sphere (extreme points along each axis, grown to include every position),
+* or the sphere around the box center if it is smaller.
+*/
+BoundingSphere ComputeBoundingSphere(const Float3* _positions, uint32_t _positionNum, const MeshBounds& _bounds);
+
+/// Sphere enclosing the box (when positions are not available, e.g. glTF accessor min / max).
+BoundingSphere ComputeBoundingSphere(const MeshBounds& _bounds);
+
+/// Compute mesh and submeshes bounds and bounding spheres.
+void ComputeMeshBounds(MeshData& _mesh);
+
+/**
+* Copy of one submesh of _mesh as a standalone mesh (0-based indices, bounds and sphere kept), without LODs and meshlets.
+* Tangents are copied when _mesh has one per vertex.
+*/
+MeshData ExtractSubmesh(const MeshData& _mesh, const Submesh& _submesh);
+
+/// Append _submesh (with its own 0-based indices) to _mesh, as a new submesh.
+void AppendSubmesh(MeshData& _mesh, const MeshData& _submesh);
@@ -0,0 +1,458 @@
+#include "Mesh/MeshFile.hpp"
+
+#include "Mesh/MeshCodec.hpp"
+#include "Mesh/VertexQuantization.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+	constexpr uint64_t blockAlignment = 16u;
+
+	uint64_t AlignUp(uint64_t _value, uint64_t _alignment)
+	{
+		return (_value + _alignment - 1) & ~(_alignment - 1);
+	}
+
+	/**
+	* Append _size bytes at the next aligned offset of _file.
+	* Return the offset of the written data.
+	*/
+	uint64_t AppendBlock(std::vector<uint8_t>& _file, const void* _data, uint64_t _size)
+	{
+		const uint64_t offset = AlignUp(_file.size(), blockAlignment);
+
+		_file.resize(offset + _size);
+
+		if (_size)
+			std::memcpy(_file.data() + offset, _data, _size);
+
+		return offset;
+	}
+
+	/**
+	* Encoded vertex streams, ready to write.
+	*/
+	struct EncodedStreams
+	{
+		std::vector<MeshFileStream> streams;
+		std::vector<std::vector<uint8_t>> data;
+
+		template <typename T>
+		void Add(VertexSemantic _semantic, VertexFormat _format, const std::vector<T>& _values)
+		{
+			streams.push_back(MeshFileStream{ .semantic = _semantic, .format = _format, .stride = sizeof(T) });
+
+			std::vector<uint8_t>& bytes = data.emplace_back(_values.size() * sizeof(T));
+			std::memcpy(bytes.data(), _values.data(), bytes.size());
+		}
+	};
+
+	struct UNorm16x4
+	{
+		uint16_t x, y, z, w;
+	};
+
+	struct SNorm16x2
+	{
+		int16_t x, y;
+	};
+
+	struct Half2
+	{
+		uint16_t x, y;
+	};
+
+	template <typename VectorT>
+	std::vector<SNorm16x2> EncodeOctahedralStream(const std::vector<VectorT>& _vectors)
+	{
+		std::vector<SNorm16x2> encoded(_vectors.size());
+
+		for (size_t i = 0; i < _vectors.size(); ++i)
+		{
+			const Float2 octahedral = EncodeOctahedral(Float3{ _vectors[i].x, _vectors[i].y, _vectors[i].z });
+			encoded[i] = SNorm16x2{ QuantizeSNorm16(octahedral.x), QuantizeSNorm16(octahedral.y) };
+		}
+
+		return encoded;
+	}
+
+	void EncodeQuantizedStreams(const MeshData& _mesh, EncodedStreams& _out)
+	{
+		const PositionDequantization dequantization = ComputePositionDequantization(_mesh.bounds);
+
+		auto quantizeAxis = [](float _value, float _scale, float _offset)
+		{
+			return _scale > 0.0f ? QuantizeUNorm16((_value - _offset) / _scale) : uint16_t(0u);
+		};
+
+		std::vector<UNorm16x4> positions(_mesh.positions.size());
+
+		for (size_t i = 0; i < positions.size(); ++i)
+		{
+			const Float3& position = _mesh.positions[i];
+
+			positions[i] = UNorm16x4{
+				quantizeAxis(position.x, dequantization.scale.x, dequantization.offset.x),
+				quantizeAxis(position.y, dequantization.scale.y, dequantization.offset.y),
+				quantizeAxis(position.z, dequantization.scale.z, dequantization.offset.z),
+
+				// Tangent handedness: 1 (+1) or 0 (-1).
+				_mesh.tangents[i].w < 0.0f ? uint16_t(0u) : uint16_t(0xFFFFu),
+			};
+		}
+
+		std::vector<Half2> uvs(_mesh.uvs.size());
+
+		for (size_t i = 0; i < uvs.size(); ++i)
+			uvs[i] = Half2{ FloatToHalf(_mesh.uvs[i].x), FloatToHalf(_mesh.uvs[i].y) };
+
+		_out.Add(VertexSemantic::Position, VertexFormat::UNorm16x4, positions);
+		_out.Add(VertexSemantic::Normal, VertexFormat::OctahedralSNorm16x2, EncodeOctahedralStream(_mesh.normals));
+		_out.Add(VertexSemantic::Tangent, VertexFormat::OctahedralSNorm16x2, EncodeOctahedralStream(_mesh.tangents));
+		_out.Add(VertexSemantic::UV, VertexFormat::Half2, uvs);
+	}
+
+	void EncodeFloatStreams(const MeshData& _mesh, EncodedStreams& _out)
+	{
+		_out.Add(VertexSemantic::Position, VertexFormat::Float3, _mesh.positions);
+		_out.Add(VertexSemantic::Normal, VertexFormat::Float3, _mesh.normals);
+		_out.Add(VertexSemantic::Tangent, VertexFormat::Float4, _mesh.tangents);
+		_out.Add(VertexSemantic::UV, VertexFormat::Float2, _mesh.uvs);
+	}
+
+	/**
+	* Encode _elementNum elements of _stride bytes (vertex stream, meshlet array) with the vertex codec (see MeshCodec.hpp).
+	* Noisy arrays (e.g. octahedral normals of a low-poly mesh) can grow: keep them raw.
+	*/
+	MeshEncoding EncodeArray(const void* _data, uint32_t _elementNum, uint32_t _stride, bool _bCompress, std::vector<uint8_t>& _outData)
+	{
+		const uint8_t* const bytes = static_cast<const uint8_t*>(_data);
+		const size_t size = static_cast<size_t>(_elementNum) * _stride;
+
+		if (_bCompress)
+		{
+			std::vector<uint8_t> compressed = EncodeVertexBuffer(bytes, _elementNum, _stride);
+
+			if (!compressed.empty() && compressed.size() < size)
+			{
+				_outData = std::move(compressed);
+				return MeshEncoding::Compressed;
+			}
+		}
+
+		_outData.assign(bytes, bytes + size);
+
+		return MeshEncoding::Raw;
+	}
+
+	/// Copy (Raw) or decode (Compressed) _elementNum elements of _stride bytes at _dst.
+	bool ReadArray(MeshEncoding _encoding, const uint8_t* _data, uint64_t _encodedSize, uint32_t _elementNum, uint32_t _stride, void* _dst)
+	{
+		if (_encoding == MeshEncoding::Compressed)
+			return DecodeVertexBuffer(_data, _encodedSize, _elementNum, _stride, _dst);
+
+		std::memcpy(_dst, _data, static_cast<size_t>(_elementNum) * _stride);
+
+		return true;
+	}
+
+	bool IsRangeValid(uint64_t _offset, uint64_t _size, uint64_t _fileSize)
+	{
+		return _offset <= _fileSize && _size <= _fileSize - _offset;
+	}
+
+	/// Raw data must be exactly _rawSize bytes.
+	bool IsArrayValid(uint64_t _offset, uint64_t _dataSize, MeshEncoding _encoding, uint64_t _rawSize, uint64_t _fileSize)
+	{
+		return IsRangeValid(_offset, _dataSize, _fileSize) && (_encoding == MeshEncoding::Compressed || _dataSize == _rawSize);
+	}
+}
+
+
+uint32_t GetVertexFormatSize(VertexFormat _format)
+{
+	switch (_format)
+	{
+		case VertexFormat::Float2:
+			return sizeof(Float2);
+		case VertexFormat::Float3:
+			return sizeof(Float3);
+		case VertexFormat::Float4:
+			return sizeof(Float4);
+		case VertexFormat::UNorm16x4:
+			return sizeof(UNorm16x4);
+		case VertexFormat::OctahedralSNorm16x2:
+			return sizeof(SNorm16x2);
+		case VertexFormat::Half2:
+			return sizeof(Half2);
+		default:
+			return 0u;
+	}
+}
+
+uint32_t GetIndexFormatSize(IndexFormat _format)
+{
+	return _format == IndexFormat::UInt16 ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+
+IndexFormat SelectIndexFormat(const MeshData& _mesh)
+{
+	for (const Submesh& submesh : _mesh.submeshes)
+	{
+		if (submesh.vertexNum > 0x10000)
+			return IndexFormat::UInt32;
+	}
+
+	return IndexFormat::UInt16;
+}
+
+
+bool WriteMeshFile(const char* _path, const MeshData& _mesh, bool _bQuantizeVertices, bool _bCompress)
+{
+	const uint32_t vertexNum = static_cast<uint32_t>(_mesh.positions.size());
+
+	if (vertexNum == 0u)
+		return false;
+
+	if (_mesh.normals.size() != vertexNum || _mesh.tangents.size() != vertexNum || _mesh.uvs.size() != vertexNum)
+		return false;
+
+	EncodedStreams encoded;
+
+	if (_bQuantizeVertices)
+		EncodeQuantizedStreams(_mesh, encoded);
+	else
+		EncodeFloatStreams(_mesh, encoded);
+
+	std::vector<MeshFileStream>& streams = encoded.streams;
+
+	MeshFileHeader header;
+	header.vertexNum = vertexNum;
+	header.indexNum = static_cast<uint32_t>(_mesh.indices.size());
+	header.indexFormat = SelectIndexFormat(_mesh);
+	header.streamNum = static_cast<uint32_t>(streams.size());
+	header.submeshNum = static_cast<uint32_t>(_mesh.submeshes.size());
+	header.lodNum = static_cast<uint32_t>(_mesh.lods.size());
+	header.meshletNum = static_cast<uint32_t>(_mesh.meshlets.size());
+	header.meshletVertexNum = static_cast<uint32_t>(_mesh.meshletVertices.size());
+	header.meshletTriangleNum = static_cast<uint32_t>(_mesh.meshletTriangles.size());
+	header.bounds = _mesh.bounds;
+	header.sphere = _mesh.sphere;
+
+	std::vector<uint8_t> file;
+
+	// Reserve header and tables: filled once data offsets are known.
+	AppendBlock(file, &header, sizeof(header));
+	header.streamTableOffset = AppendBlock(file, streams.data(), streams.size() * sizeof(MeshFileStream));
+	header.submeshTableOffset = AppendBlock(file, _mesh.submeshes.data(), _mesh.submeshes.size() * sizeof(Submesh));
+	header.lodTableOffset = AppendBlock(file, _mesh.lods.data(), _mesh.lods.size() * sizeof(MeshLOD));
+
+	std::vector<uint8_t> data;
+
+	for (size_t i = 0; i < streams.size(); ++i)
+	{
+		streams[i].encoding = EncodeArray(encoded.data[i].data(), vertexNum, streams[i].stride, _bCompress, data);
+		streams[i].size = data.size();
+		streams[i].offset = AppendBlock(file, data.data(), data.size());
+	}
+
+	if (_bCompress)
+	{
+		// Index format only matters once decoded.
+		const std::vector<uint8_t> encodedIndices = EncodeIndexBuffer(_mesh.indices.data(), header.indexNum);
+
+		header.indexEncoding = MeshEncoding::Compressed;
+		header.indexDataSize = encodedIndices.size();
+		header.indexOffset = AppendBlock(file, encodedIndices.data(), encodedIndices.size());
+	}
+	else if (header.indexFormat == IndexFormat::UInt16)
+	{
+		const std::vector<uint16_t> indices16(_mesh.indices.begin(), _mesh.indices.end());
+		header.indexDataSize = indices16.size() * sizeof(uint16_t);
+		header.indexOffset = AppendBlock(file, indices16.data(), header.indexDataSize);
+	}
+	else
+	{
+		header.indexDataSize = _mesh.indices.size() * sizeof(uint32_t);
+		header.indexOffset = AppendBlock(file, _mesh.indices.data(), header.indexDataSize);
+	}
+
+	// Meshlet offsets / counts grow slowly and meshlet vertices are small indices: delta-packed as vertex buffers.
+	header.meshletTableEncoding = EncodeArray(_mesh.meshlets.data(), header.meshletNum, sizeof(Meshlet), _bCompress, data);
+	header.meshletTableDataSize = data.size();
+	header.meshletTableOffset = AppendBlock(file, data.data(), data.size());
+
+	header.meshletVertexEncoding = EncodeArray(_mesh.meshletVertices.data(), header.meshletVertexNum, sizeof(uint32_t), _bCompress, data);
+	header.meshletVertexDataSize = data.size();
+	header.meshletVertexOffset = AppendBlock(file, data.data(), data.size());
+
+	header.meshletTriangleEncoding = EncodeArray(_mesh.meshletTriangles.data(), header.meshletTriangleNum, sizeof(uint32_t), _bCompress, data);
+	header.meshletTriangleDataSize = data.size();
+	header.meshletTriangleOffset = AppendBlock(file, data.data(), data.size());
+
+	std::memcpy(file.data(), &header, sizeof(header));
+	std::memcpy(file.data() + header.streamTableOffset, streams.data(), streams.size() * sizeof(MeshFileStream));
+
+
+	FILE* outFile = std::fopen(_path, "wb");
+	if (!outFile)
+		return false;
+
+	bool bSuccess = std::fwrite(file.data(), 1, file.size(), outFile) == file.size();
+	bSuccess &= std::fclose(outFile) == 0;
+
+	return bSuccess;
+}
+
+
+const MeshStreamView* MeshFileView::FindStream(VertexSemantic _semantic) const
+{
+	for (const MeshStreamView& stream : streams)
+	{
+		if (stream.semantic == _semantic)
+			return &stream;
+	}
+
+	return nullptr;
+}
+
+bool ParseMeshFile(const uint8_t* _data, uint64_t _size, MeshFileView& _outMesh)
+{
+	if (_size < sizeof(MeshFileHeader))
+		return false;
+
+	MeshFileHeader header;
+	std::memcpy(&header, _data, sizeof(header));
+
+	if (header.magic != meshFileMagic || header.version != meshFileVersion)
+		return false;
+
+	const uint64_t streamTableSize = static_cast<uint64_t>(header.streamNum) * sizeof(MeshFileStream);
+	const uint64_t submeshTableSize = static_cast<uint64_t>(header.submeshNum) * sizeof(Submesh);
+	const uint64_t lodTableSize = static_cast<uint64_t>(header.lodNum) * sizeof(MeshLOD);
+	const uint64_t indexSize = static_cast<uint64_t>(header.indexNum) * GetIndexFormatSize(header.indexFormat);
+	const uint64_t meshletTableSize = static_cast<uint64_t>(header.meshletNum) * sizeof(Meshlet);
+
+	if (!IsRangeValid(header.streamTableOffset, streamTableSize, _size) ||
+		!IsRangeValid(header.submeshTableOffset, submeshTableSize, _size) ||
+		!IsRangeValid(header.lodTableOffset, lodTableSize, _size) ||
+		!IsRangeValid(header.indexOffset, header.indexDataSize, _size) ||
+		(header.indexEncoding == MeshEncoding::Raw && header.indexDataSize != indexSize) ||
+		!IsArrayValid(header.meshletTableOffset, header.meshletTableDataSize, header.meshletTableEncoding, meshletTableSize, _size) ||
+		!IsArrayValid(header.meshletVertexOffset, header.meshletVertexDataSize, header.meshletVertexEncoding, static_cast<uint64_t>(header.meshletVertexNum) * sizeof(uint32_t), _size) ||
+		!IsArrayValid(header.meshletTriangleOffset, header.meshletTriangleDataSize, header.meshletTriangleEncoding, static_cast<uint64_t>(header.meshletTriangleNum) * sizeof(uint32_t), _size))
+		return false;
+
+	_outMesh.vertexNum = header.vertexNum;
+	_outMesh.indexNum = header.indexNum;
+	_outMesh.indexFormat = header.indexFormat;
+	_outMesh.bounds = header.bounds;
+	_outMesh.sphere = header.sphere;
+
+	_outMesh.indexSize = indexSize;
+	_outMesh.indexEncoding = header.indexEncoding;
+	_outMesh.indices = _data + header.indexOffset;
+	_outMesh.indexEncodedSize = header.indexDataSize;
+
+	_outMesh.streams.resize(header.streamNum);
+
+	for (uint32_t i = 0; i < header.streamNum; ++i)
+	{
+		MeshFileStream stream;
+		std::memcpy(&stream, _data + header.streamTableOffset + i * sizeof(MeshFileStream), sizeof(stream));
+
+		const uint64_t streamSize = static_cast<uint64_t>(stream.stride) * header.vertexNum;
+
+		if (!IsRangeValid(stream.offset, stream.size, _size) || (stream.encoding == MeshEncoding::Raw && stream.size < streamSize))
+			return false;
+
+		_outMesh.streams[i] = MeshStreamView{
+			.semantic = stream.semantic,
+			.format = stream.format,
+			.stride = stream.stride,
+			.size = streamSize,
+			.encoding = stream.encoding,
+			.data = _data + stream.offset,
+			.encodedSize = stream.size,
+		};
+	}
+
+	// Small table: copy (file memory is not guaranteed to be aligned for direct access).
+	_outMesh.submeshes.resize(header.submeshNum);
+
+	if (submeshTableSize)
+		std::memcpy(_outMesh.submeshes.data(), _data + header.submeshTableOffset, submeshTableSize);
+
+	for (const Submesh& submesh : _outMesh.submeshes)
+	{
+		if (static_cast<uint64_t>(submesh.indexOffset) + submesh.indexNum > header.indexNum ||
+			static_cast<uint64_t>(submesh.baseVertex) + submesh.vertexNum > header.vertexNum ||
+			static_cast<uint64_t>(submesh.meshletOffset) + submesh.meshletNum > header.meshletNum ||
+			static_cast<uint64_t>(submesh.lodOffset) + submesh.lodNum > header.lodNum)
+			return false;
+	}
+
+	_outMesh.lods.resize(header.lodNum);
+
+	if (lodTableSize)
+		std::memcpy(_outMesh.lods.data(), _data + header.lodTableOffset, lodTableSize);
+
+	for (const MeshLOD& lod : _outMesh.lods)
+	{
+		if (static_cast<uint64_t>(lod.indexOffset) + lod.indexNum > header.indexNum)
+			return false;
+	}
+
+	_outMesh.meshlets.resize(header.meshletNum);
+
+	if (meshletTableSize && !ReadArray(header.meshletTableEncoding, _data + header.meshletTableOffset, header.meshletTableDataSize, header.meshletNum, sizeof(Meshlet), _outMesh.meshlets.data()))
+		return false;
+
+	for (const Meshlet& meshlet : _outMesh.meshlets)
+	{
+		if (static_cast<uint64_t>(meshlet.vertexOffset) + meshlet.vertexNum > header.meshletVertexNum ||
+			static_cast<uint64_t>(meshlet.triangleOffset) + meshlet.triangleNum > header.meshletTriangleNum ||
+			(static_cast<uint64_t>(meshlet.triangleOffset) + meshlet.triangleNum) * 3 > header.indexNum)
+			return false;
+	}
+
+	_outMesh.meshletVertexEncoding = header.meshletVertexEncoding;
+	_outMesh.meshletVertices = _data + header.meshletVertexOffset;
+	_outMesh.meshletVertexEncodedSize = header.meshletVertexDataSize;
+	_outMesh.meshletVertexNum = header.meshletVertexNum;
+
+	_outMesh.meshletTriangleEncoding = header.meshletTriangleEncoding;
+	_outMesh.meshletTriangles = _data + header.meshletTriangleOffset;
+	_outMesh.meshletTriangleEncodedSize = header.meshletTriangleDataSize;
+	_outMesh.meshletTriangleNum = header.meshletTriangleNum;
+
+	return true;
+}
+
+bool ReadMeshStream(const MeshFileView& _mesh, const MeshStreamView& _stream, void* _dst)
+{
+	return ReadArray(_stream.encoding, _stream.data, _stream.encodedSize, _mesh.vertexNum, _stream.stride, _dst);
+}
+
+bool ReadMeshIndices(const MeshFileView& _mesh, void* _dst)
+{
+	if (_mesh.indexEncoding == MeshEncoding::Compressed)
+		return DecodeIndexBuffer(_mesh.indices, _mesh.indexEncodedSize, _mesh.indexNum, GetIndexFormatSize(_mesh.indexFormat), _dst);
+
+	std::memcpy(_dst, _mesh.indices, _mesh.indexSize);
+
+	return true;
+}
+
+bool ReadMeshletVertices(const MeshFileView& _mesh, void* _dst)
+{
+	return ReadArray(_mesh.meshletVertexEncoding, _mesh.meshletVertices, _mesh.meshletVertexEncodedSize, _mesh.meshletVertexNum, sizeof(uint32_t), _dst);
+}
+
+bool ReadMeshletTriangles(const MeshFileView& _mesh, void* _dst)
+{
+	return ReadArray(_mesh.meshletTriangleEncoding, _mesh.meshletTriangles, _mesh.meshletTriangleEncodedSize, _mesh.meshletTriangleNum, sizeof(uint32_t), _dst);
+}
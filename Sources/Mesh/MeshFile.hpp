@@ -0,0 +1,230 @@
+#pragma once
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Cooked mesh binary format (.mesh), written by MeshCooker.
+* GPU-ready data: the runtime memory-maps the file and copies streams straight into staging memory (no parsing, no repacking).
+*
+* File layout (little-endian, every block 16 bytes aligned):
+*   - MeshFileHeader
+*   - MeshFileStream table (streamNum)
+*   - Submesh table (submeshNum)
+*   - MeshLOD table (lodNum)
+*   - vertex streams data (non-interleaved, one vertex buffer per stream), raw or compressed (see MeshEncoding)
+*   - index buffer data (submeshes, then LODs), raw or compressed
+*   - Meshlet table (meshletNum), meshlet vertices (uint32) and meshlet triangles (uint32, packed 10:10:10), each raw or compressed
+*
+* Bump meshFileVersion on any layout change: old files are rejected and must be re-cooked.
+*/
+
+constexpr uint32_t meshFileMagic = 0x4853454D; // 'MESH'
+constexpr uint32_t meshFileVersion = 9u;
+
+
+enum class VertexSemantic : uint32_t
+{
+	Position,
+	Normal,
+	Tangent,
+	UV,
+};
+
+enum class VertexFormat : uint32_t
+{
+	Float2,
+	Float3,
+
+	/// Tangent with handedness in w.
+	Float4,
+
+	/// DXGI_FORMAT_R16G16B16A16_UNORM: position relative to mesh bounds, tangent handedness in w (0: -1, 1: +1).
+	UNorm16x4,
+
+	/// DXGI_FORMAT_R16G16_SNORM: octahedral unit vector.
+	OctahedralSNorm16x2,
+
+	/// DXGI_FORMAT_R16G16_FLOAT.
+	Half2,
+};
+
+enum class IndexFormat : uint32_t
+{
+	UInt16,
+	UInt32,
+};
+
+/**
+* Vertex stream / index buffer / meshlet array storage.
+*/
+enum class MeshEncoding : uint32_t
+{
+	/// GPU-ready data: copied straight into staging memory.
+	Raw,
+
+	/// MeshCodec.hpp: decoded in parallel straight into staging memory.
+	Compressed,
+};
+
+uint32_t GetVertexFormatSize(VertexFormat _format);
+uint32_t GetIndexFormatSize(IndexFormat _format);
+
+
+struct MeshFileHeader
+{
+	uint32_t magic = meshFileMagic;
+	uint32_t version = meshFileVersion;
+
+	uint32_t vertexNum = 0u;
+	uint32_t indexNum = 0u;
+	IndexFormat indexFormat = IndexFormat::UInt16;
+
+	uint32_t streamNum = 0u;
+	uint32_t submeshNum = 0u;
+
+	uint32_t lodNum = 0u;
+
+	uint32_t meshletNum = 0u;
+	uint32_t meshletVertexNum = 0u;
+	uint32_t meshletTriangleNum = 0u;
+	MeshEncoding indexEncoding = MeshEncoding::Raw;
+
+	MeshBounds bounds;
+	BoundingSphere sphere;
+
+	// Offsets from the start of the file.
+	uint64_t streamTableOffset = 0u;
+	uint64_t submeshTableOffset = 0u;
+	uint64_t lodTableOffset = 0u;
+	uint64_t indexOffset = 0u;
+	uint64_t meshletTableOffset = 0u;
+	uint64_t meshletVertexOffset = 0u;
+	uint64_t meshletTriangleOffset = 0u;
+
+	/// Index data size in the file (indexNum * index format size if Raw).
+	uint64_t indexDataSize = 0u;
+
+	/// Meshlet arrays data size in the file (element num * element size if Raw).
+	uint64_t meshletTableDataSize = 0u;
+	uint64_t meshletVertexDataSize = 0u;
+	uint64_t meshletTriangleDataSize = 0u;
+
+	/// Meshlet arrays are compressed with the vertex codec (one element per vertex).
+	MeshEncoding meshletTableEncoding = MeshEncoding::Raw;
+	MeshEncoding meshletVertexEncoding = MeshEncoding::Raw;
+	MeshEncoding meshletTriangleEncoding = MeshEncoding::Raw;
+	uint32_t padding = 0u;
+};
+
+struct MeshFileStream
+{
+	VertexSemantic semantic = VertexSemantic::Position;
+	VertexFormat format = VertexFormat::Float3;
+	uint32_t stride = 0u;
+	MeshEncoding encoding = MeshEncoding::Raw;
+
+	// Offset from the start of the file.
+	uint64_t offset = 0u;
+	uint64_t size = 0u;
+};
+
+static_assert(sizeof(MeshFileHeader) == 192, "MeshFileHeader layout changed: bump meshFileVersion");
+static_assert(sizeof(MeshFileStream) == 32, "MeshFileStream layout changed: bump meshFileVersion");
+static_assert(sizeof(Submesh) == 72, "Submesh layout changed: bump meshFileVersion");
+static_assert(sizeof(MeshLOD) == 12, "MeshLOD layout changed: bump meshFileVersion");
+static_assert(sizeof(Meshlet) == 48, "Meshlet layout changed: bump meshFileVersion");
+
+
+/**
+* Smallest index format for _mesh: 16-bit if every submesh has at most 65536 vertices (indices are relative to baseVertex).
+*/
+IndexFormat SelectIndexFormat(const MeshData& _mesh);
+
+/**
+* Write _mesh to a .mesh file.
+* _bQuantizeVertices: store compressed streams (see VertexQuantization.hpp) instead of full floats.
+* _bCompress: encode vertex streams, indices and meshlet arrays with MeshCodec.hpp (lossless, on top of quantization),
+* arrays that don't get smaller are kept raw.
+* Index format is chosen with SelectIndexFormat().
+*/
+bool WriteMeshFile(const char* _path, const MeshData& _mesh, bool _bQuantizeVertices, bool _bCompress);
+
+
+/**
+* Parsed .mesh file: views into the file memory (typically memory-mapped), no copy.
+*/
+struct MeshStreamView
+{
+	VertexSemantic semantic = VertexSemantic::Position;
+	VertexFormat format = VertexFormat::Float3;
+	uint32_t stride = 0u;
+
+	/// GPU buffer size (vertexNum * stride).
+	uint64_t size = 0u;
+
+	/// File data (encodedSize bytes): GPU-ready if Raw.
+	MeshEncoding encoding = MeshEncoding::Raw;
+	const uint8_t* data = nullptr;
+	uint64_t encodedSize = 0u;
+};
+
+struct MeshFileView
+{
+	uint32_t vertexNum = 0u;
+	uint32_t indexNum = 0u;
+	IndexFormat indexFormat = IndexFormat::UInt16;
+
+	MeshBounds bounds;
+	BoundingSphere sphere;
+
+	std::vector<MeshStreamView> streams;
+
+	/// GPU buffer size (indexNum * index format size).
+	uint64_t indexSize = 0u;
+
+	/// File data (indexEncodedSize bytes): GPU-ready if Raw.
+	MeshEncoding indexEncoding = MeshEncoding::Raw;
+	const uint8_t* indices = nullptr;
+	uint64_t indexEncodedSize = 0u;
+
+	std::vector<Submesh> submeshes;
+	std::vector<MeshLOD> lods;
+
+	std::vector<Meshlet> meshlets;
+
+	/// Meshlet buffers (see MeshData): file data (encodedSize bytes), GPU-ready if Raw.
+	MeshEncoding meshletVertexEncoding = MeshEncoding::Raw;
+	const uint8_t* meshletVertices = nullptr;
+	uint64_t meshletVertexEncodedSize = 0u;
+	uint32_t meshletVertexNum = 0u;
+
+	MeshEncoding meshletTriangleEncoding = MeshEncoding::Raw;
+	const uint8_t* meshletTriangles = nullptr;
+	uint64_t meshletTriangleEncodedSize = 0u;
+	uint32_t meshletTriangleNum = 0u;
+
+	/// Return nullptr if the mesh doesn't have this stream.
+	const MeshStreamView* FindStream(VertexSemantic _semantic) const;
+};
+
+/**
+* Parse a .mesh file in memory.
+* Return false on invalid file or version mismatch.
+*/
+bool ParseMeshFile(const uint8_t* _data, uint64_t _size, MeshFileView& _outMesh);
+
+/**
+* Write the GPU-ready _stream (_stream.size bytes) at _dst, typically staging memory:
+* copy (Raw) or parallel decode (Compressed).
+* Return false on corrupted data.
+*/
+bool ReadMeshStream(const MeshFileView& _mesh, const MeshStreamView& _stream, void* _dst);
+
+/// Same as ReadMeshStream() for the index buffer (_mesh.indexSize bytes).
+bool ReadMeshIndices(const MeshFileView& _mesh, void* _dst);
+
+/// Same as ReadMeshStream() for the meshlet vertices (_mesh.meshletVertexNum uint32).
+bool ReadMeshletVertices(const MeshFileView& _mesh, void* _dst);
+
+/// Same as ReadMeshStream() for the meshlet triangles (_mesh.meshletTriangleNum uint32).
+bool ReadMeshletTriangles(const MeshFileView& _mesh, void* _dst);
@@ -0,0 +1,460 @@
+#include "Mesh/MeshOptimizer.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+	/**
+	* Vertex -> triangles adjacency (compressed: triangles of vertex v are in [offsets[v], offsets[v + 1])).
+	*/
+	struct TriangleAdjacency
+	{
+		std::vector<uint32_t> offsets;
+		std::vector<uint32_t> triangles;
+	};
+
+	void BuildTriangleAdjacency(const uint32_t* _indices, uint32_t _indexNum, uint32_t _vertexNum, TriangleAdjacency& _out)
+	{
+		_out.offsets.assign(_vertexNum + 1, 0u);
+		_out.triangles.resize(_indexNum);
+
+		for (uint32_t i = 0; i < _indexNum; ++i)
+			++_out.offsets[_indices[i] + 1];
+
+		for (uint32_t v = 0; v < _vertexNum; ++v)
+			_out.offsets[v + 1] += _out.offsets[v];
+
+		std::vector<uint32_t> fill(_out.offsets.begin(), _out.offsets.end() - 1);
+
+		for (uint32_t i = 0; i < _indexNum; ++i)
+			_out.triangles[fill[_indices[i]]++] = i / 3;
+	}
+
+
+	/**
+	* FIFO cache simulation: store the timestamp of each vertex entering the cache.
+	*/
+	class FIFOCache
+	{
+	public:
+		FIFOCache(uint32_t _vertexNum, uint32_t _cacheSize) :
+			mTimestamps(_vertexNum, 0u),
+			mCacheSize(_cacheSize),
+			mTime(_cacheSize + 1)
+		{
+		}
+
+		/// Return true on cache miss.
+		bool Access(uint32_t _vertex)
+		{
+			if (mTime - mTimestamps[_vertex] <= mCacheSize)
+				return false;
+
+			mTimestamps[_vertex] = mTime++;
+			return true;
+		}
+
+		void Reset()
+		{
+			// Push every entry out of the cache.
+			mTime += mCacheSize + 1;
+		}
+
+	private:
+		std::vector<uint32_t> mTimestamps;
+		uint32_t mCacheSize = 0u;
+		uint32_t mTime = 0u;
+	};
+
+
+	Float3 Sub(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{ _lhs.x - _rhs.x, _lhs.y - _rhs.y, _lhs.z - _rhs.z };
+	}
+
+	Float3 Cross(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{
+			_lhs.y * _rhs.z - _lhs.z * _rhs.y,
+			_lhs.z * _rhs.x - _lhs.x * _rhs.z,
+			_lhs.x * _rhs.y - _lhs.y * _rhs.x,
+		};
+	}
+}
+
+
+VertexCacheStats AnalyzeVertexCache(const uint32_t* _indices, uint32_t _indexNum, uint32_t _vertexNum, uint32_t _cacheSize)
+{
+	VertexCacheStats stats;
+
+	if (_indexNum == 0u)
+		return stats;
+
+	FIFOCache cache(_vertexNum, _cacheSize);
+	std::vector<bool> bReferenced(_vertexNum, false);
+
+	uint32_t missNum = 0u;
+	uint32_t referencedNum = 0u;
+
+	for (uint32_t i = 0; i < _indexNum; ++i)
+	{
+		const uint32_t vertex = _indices[i];
+
+		missNum += cache.Access(vertex) ? 1u : 0u;
+
+		if (!bReferenced[vertex])
+		{
+			bReferenced[vertex] = true;
+			++referencedNum;
+		}
+	}
+
+	stats.acmr = static_cast<float>(missNum) / static_cast<float>(_indexNum / 3);
+	stats.atvr = static_cast<float>(missNum) / static_cast<float>(referencedNum);
+
+	return stats;
+}
+
+
+void OptimizeVertexCache(uint32_t* _indices, uint32_t _indexNum, uint32_t _vertexNum, uint32_t _cacheSize)
+{
+	const uint32_t triangleNum = _indexNum / 3;
+
+	if (triangleNum == 0u)
+		return;
+
+	TriangleAdjacency adjacency;
+	BuildTriangleAdjacency(_indices, _indexNum, _vertexNum, adjacency);
+
+	// Non-emitted triangles count per vertex.
+	std::vector<uint32_t> liveTriangles(_vertexNum);
+	for (uint32_t v = 0; v < _vertexNum; ++v)
+		liveTriangles[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+
+	std::vector<uint32_t> cacheTimestamps(_vertexNum, 0u);
+	uint32_t time = _cacheSize + 1;
+
+	std::vector<bool> bEmitted(triangleNum, false);
+
+	// Recently used vertices, to restart from when the current fan is exhausted.
+	std::vector<uint32_t> deadEndStack;
+	deadEndStack.reserve(_indexNum);
+
+	std::vector<uint32_t> candidates;
+	candidates.reserve(64);
+
+	std::vector<uint32_t> output;
+	output.reserve(_indexNum);
+
+	uint32_t nextInputVertex = 0u;
+
+	// Start from the first referenced vertex.
+	int64_t fanVertex = _indices[0];
+
+	while (fanVertex >= 0)
+	{
+		candidates.clear();
+
+		// Emit all remaining triangles around the fanning vertex.
+		for (uint32_t i = adjacency.offsets[fanVertex]; i < adjacency.offsets[fanVertex + 1]; ++i)
+		{
+			const uint32_t triangle = adjacency.triangles[i];
+
+			if (bEmitted[triangle])
+				continue;
+
+			bEmitted[triangle] = true;
+
+			for (uint32_t j = 0; j < 3; ++j)
+			{
+				const uint32_t vertex = _indices[triangle * 3 + j];
+
+				output.push_back(vertex);
+				deadEndStack.push_back(vertex);
+				candidates.push_back(vertex);
+
+				--liveTriangles[vertex];
+
+				if (time - cacheTimestamps[vertex] > _cacheSize)
+					cacheTimestamps[vertex] = time++;
+			}
+		}
+
+		// Next fanning vertex: the candidate that will still be in cache after emitting its remaining triangles, oldest in cache first.
+		fanVertex = -1;
+		int64_t bestPriority = -1;
+
+		for (uint32_t vertex : candidates)
+		{
+			if (liveTriangles[vertex] == 0u)
+				continue;
+
+			int64_t priority = 0;
+
+			if (time - cacheTimestamps[vertex] + 2 * liveTriangles[vertex] <= _cacheSize)
+				priority = time - cacheTimestamps[vertex];
+
+			if (priority > bestPriority)
+			{
+				bestPriority = priority;
+				fanVertex = vertex;
+			}
+		}
+
+		if (fanVertex >= 0)
+			continue;
+
+		// Dead-end: restart from a recently used vertex, then from the input order.
+		while (!deadEndStack.empty())
+		{
+			const uint32_t vertex = deadEndStack.back();
+			deadEndStack.pop_back();
+
+			if (liveTriangles[vertex] > 0u)
+			{
+				fanVertex = vertex;
+				break;
+			}
+		}
+
+		while (fanVertex < 0 && nextInputVertex < _vertexNum)
+		{
+			if (liveTriangles[nextInputVertex] > 0u)
+				fanVertex = nextInputVertex;
+
+			++nextInputVertex;
+		}
+	}
+
+	std::copy(output.begin(), output.end(), _indices);
+}
+
+
+void OptimizeOverdraw(uint32_t* _indices, uint32_t _indexNum, const Float3* _positions, uint32_t _vertexNum, float _threshold)
+{
+	const uint32_t triangleNum = _indexNum / 3;
+
+	if (triangleNum == 0u)
+		return;
+
+	// Hard boundaries: cache restarts of the vertex cache optimized order (triangle with 3 misses).
+	std::vector<uint32_t> hardClusters;
+	{
+		FIFOCache cache(_vertexNum, vertexCacheSize);
+
+		for (uint32_t t = 0; t < triangleNum; ++t)
+		{
+			uint32_t missNum = 0u;
+
+			for (uint32_t j = 0; j < 3; ++j)
+				missNum += cache.Access(_indices[t * 3 + j]) ? 1u : 0u;
+
+			if (t == 0u || missNum == 3u)
+				hardClusters.push_back(t);
+		}
+
+		hardClusters.push_back(triangleNum);
+	}
+
+	// Soft boundaries: split hard clusters as soon as their local ACMR is within _threshold of the mesh ACMR.
+	std::vector<uint32_t> clusters;
+	{
+		const float meshACMR = AnalyzeVertexCache(_indices, _indexNum, _vertexNum).acmr;
+		const float clusterThreshold = _threshold * meshACMR;
+
+		FIFOCache cache(_vertexNum, vertexCacheSize);
+
+		for (size_t c = 0; c + 1 < hardClusters.size(); ++c)
+		{
+			const uint32_t end = hardClusters[c + 1];
+
+			cache.Reset();
+
+			uint32_t clusterStart = hardClusters[c];
+			uint32_t clusterMissNum = 0u;
+
+			clusters.push_back(clusterStart);
+
+			for (uint32_t t = clusterStart; t < end; ++t)
+			{
+				for (uint32_t j = 0; j < 3; ++j)
+					clusterMissNum += cache.Access(_indices[t * 3 + j]) ? 1u : 0u;
+
+				const uint32_t clusterTriangleNum = t + 1 - clusterStart;
+
+				// Split (the cache is restarted, as the cluster will move).
+				if (t + 1 < end && static_cast<float>(clusterMissNum) <= clusterThreshold * static_cast<float>(clusterTriangleNum))
+				{
+					clusterStart = t + 1;
+					clusterMissNum = 0u;
+
+					clusters.push_back(clusterStart);
+					cache.Reset();
+				}
+			}
+		}
+
+		clusters.push_back(triangleNum);
+	}
+
+	// Sort clusters: outward facing first (dot(cluster centroid - mesh centroid, cluster normal), descending).
+	const size_t clusterNum = clusters.size() - 1;
+
+	Float3 meshCentroid;
+	for (uint32_t i = 0; i < _indexNum; ++i)
+	{
+		const Float3& position = _positions[_indices[i]];
+
+		meshCentroid.x += position.x / static_cast<float>(_indexNum);
+		meshCentroid.y += position.y / static_cast<float>(_indexNum);
+		meshCentroid.z += position.z / static_cast<float>(_indexNum);
+	}
+
+	std::vector<float> sortKeys(clusterNum);
+
+	for (size_t c = 0; c < clusterNum; ++c)
+	{
+		// Area-weighted centroid and normal.
+		Float3 centroid;
+		Float3 normal;
+		float area = 0.0f;
+
+		for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t)
+		{
+			const Float3& p0 = _positions[_indices[t * 3]];
+			const Float3& p1 = _positions[_indices[t * 3 + 1]];
+			const Float3& p2 = _positions[_indices[t * 3 + 2]];
+
+			const Float3 triangleNormal = Cross(Sub(p1, p0), Sub(p2, p0));
+			const float triangleArea = std::sqrt(triangleNormal.x * triangleNormal.x + triangleNormal.y * triangleNormal.y + triangleNormal.z * triangleNormal.z);
+
+			centroid.x += (p0.x + p1.x + p2.x) / 3.0f * triangleArea;
+			centroid.y += (p0.y + p1.y + p2.y) / 3.0f * triangleArea;
+			centroid.z += (p0.z + p1.z + p2.z) / 3.0f * triangleArea;
+
+			normal.x += triangleNormal.x;
+			normal.y += triangleNormal.y;
+			normal.z += triangleNormal.z;
+
+			area += triangleArea;
+		}
+
+		if (area > 0.0f)
+		{
+			centroid.x /= area;
+			centroid.y /= area;
+			centroid.z /= area;
+		}
+
+		const Float3 offset = Sub(centroid, meshCentroid);
+
+		sortKeys[c] = offset.x * normal.x + offset.y * normal.y + offset.z * normal.z;
+	}
+
+	std::vector<uint32_t> clusterOrder(clusterNum);
+	for (uint32_t c = 0; c < clusterNum; ++c)
+		clusterOrder[c] = c;
+
+	std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&sortKeys](uint32_t _lhs, uint32_t _rhs)
+	{
+		return sortKeys[_lhs] > sortKeys[_rhs];
+	});
+
+	std::vector<uint32_t> output;
+	output.reserve(_indexNum);
+
+	for (uint32_t c : clusterOrder)
+		output.insert(output.end(), _indices + clusters[c] * 3, _indices + clusters[c + 1] * 3);
+
+	std::copy(output.begin(), output.end(), _indices);
+}
+
+
+void OptimizeVertexFetch(MeshData& _mesh)
+{
+	const uint32_t vertexNum = static_cast<uint32_t>(_mesh.positions.size());
+
+	constexpr uint32_t unassigned = ~0u;
+	std::vector<uint32_t> remap(vertexNum, unassigned);
+
+	// Vertices stay in their submesh range: indices are relative to baseVertex.
+	for (const Submesh& submesh : _mesh.submeshes)
+	{
+		uint32_t* const remapBegin = remap.data() + submesh.baseVertex;
+		uint32_t nextVertex = 0u;
+
+		for (uint32_t i = submesh.indexOffset; i < submesh.indexOffset + submesh.indexNum; ++i)
+		{
+			uint32_t& index = _mesh.indices[i];
+
+			if (remapBegin[index] == unassigned)
+				remapBegin[index] = nextVertex++;
+
+			index = remapBegin[index];
+		}
+
+		for (uint32_t v = 0; v < submesh.vertexNum; ++v)
+		{
+			if (remapBegin[v] == unassigned)
+				remapBegin[v] = nextVertex++;
+
+			remapBegin[v] += submesh.baseVertex;
+		}
+	}
+
+	// Vertices outside of any submesh.
+	for (uint32_t v = 0; v < vertexNum; ++v)
+	{
+		if (remap[v] == unassigned)
+			remap[v] = v;
+	}
+
+	auto reorder = [&remap]<typename T>(std::vector<T>& _stream)
+	{
+		if (_stream.empty())
+			return;
+
+		std::vector<T> reordered(_stream.size());
+
+		for (size_t i = 0; i < _stream.size(); ++i)
+			reordered[remap[i]] = _stream[i];
+
+		_stream = std::move(reordered);
+	};
+
+	reorder(_mesh.positions);
+	reorder(_mesh.normals);
+	reorder(_mesh.tangents);
+	reorder(_mesh.uvs);
+}
+
+
+VertexCacheStats AnalyzeVertexCache(const MeshData& _mesh, uint32_t _cacheSize)
+{
+	// Absolute indices: submeshes are analyzed as drawn one after the other.
+	std::vector<uint32_t> indices;
+	indices.reserve(_mesh.indices.size());
+
+	for (const Submesh& submesh : _mesh.submeshes)
+	{
+		for (uint32_t i = submesh.indexOffset; i < submesh.indexOffset + submesh.indexNum; ++i)
+			indices.push_back(_mesh.indices[i] + submesh.baseVertex);
+	}
+
+	return AnalyzeVertexCache(indices.data(), static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(_mesh.positions.size()), _cacheSize);
+}
+
+
+void OptimizeMesh(MeshData& _mesh)
+{
+	for (const Submesh& submesh : _mesh.submeshes)
+	{
+		uint32_t* const indices = _mesh.indices.data() + submesh.indexOffset;
+
+		OptimizeVertexCache(indices, submesh.indexNum, submesh.vertexNum);
+		OptimizeOverdraw(indices, submesh.indexNum, _mesh.positions.data() + submesh.baseVertex, submesh.vertexNum);
+	}
+
+	OptimizeVertexFetch(_mesh);
+}
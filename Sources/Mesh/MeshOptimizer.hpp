@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Mesh optimization passes, run at cook time (see MeshCooker).
+* Order matters: vertex cache -> overdraw -> vertex fetch.
+*/
+
+/// Post-transform vertex cache size (FIFO) used for optimization and analysis.
+constexpr uint32_t vertexCacheSize = 16u;
+
+
+struct VertexCacheStats
+{
+	/// Average Cache Miss Ratio: transformed vertices per triangle (0.5 best, 3 worst).
+	float acmr = 0.0f;
+
+	/// Average Transformed Vertex Ratio: transformed vertices per referenced vertex (1 best).
+	float atvr = 0.0f;
+};
+
+/**
+* Simulate a FIFO post-transform vertex cache of _cacheSize entries on the triangle list.
+*/
+VertexCacheStats AnalyzeVertexCache(const uint32_t* _indices, uint32_t _indexNum, uint32_t _vertexNum, uint32_t _cacheSize = vertexCacheSize);
+
+/// Analyze every submesh of _mesh, drawn in order.
+VertexCacheStats AnalyzeVertexCache(const MeshData& _mesh, uint32_t _cacheSize = vertexCacheSize);
+
+
+/**
+* Reorder triangles for post-transform vertex cache hits.
+* Tipsify (Sander, Nehab, Barczak 2007): linear time, fans around the vertex that keeps the most vertices in cache.
+*/
+void OptimizeVertexCache(uint32_t* _indices, uint32_t _indexNum, uint32_t _vertexNum, uint32_t _cacheSize = vertexCacheSize);
+
+/**
+* Reorder clusters of triangles to reduce overdraw (Sander, Nehab, Barczak 2007), keeping the vertex cache efficiency.
+* Must run after OptimizeVertexCache(): triangles are split into clusters at cache restarts,
+* then clusters facing outward (likely occluders) are drawn first.
+* _threshold: allowed ACMR degradation (1.05 = 5% worse) to create more, smaller clusters.
+*/
+void OptimizeOverdraw(uint32_t* _indices, uint32_t _indexNum, const Float3* _positions, uint32_t _vertexNum, float _threshold = 1.05f);
+
+/**
+* Reorder vertices in first-use order of the index buffer (vertex fetch locality) and remap indices.
+* Vertices are reordered inside their submesh range, unreferenced vertices are moved to the end of the range.
+*/
+void OptimizeVertexFetch(MeshData& _mesh);
+
+
+/**
+* Run every pass on each submesh, then reorder vertices.
+*/
+void OptimizeMesh(MeshData& _mesh);
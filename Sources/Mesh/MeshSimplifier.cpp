@@ -0,0 +1,461 @@
+#include "Mesh/MeshSimplifier.hpp"
+
+#include "Mesh/MeshOptimizer.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <unordered_set>
+
+namespace
+{
+	/**
+	* Sum of squared distances to planes (symmetric 4x4 matrix, upper triangle), weighted by triangle area.
+	*/
+	struct Quadric
+	{
+		double a2 = 0.0, ab = 0.0, ac = 0.0, ad = 0.0;
+		double b2 = 0.0, bc = 0.0, bd = 0.0;
+		double c2 = 0.0, cd = 0.0;
+		double d2 = 0.0;
+
+		double weight = 0.0;
+
+		void AddPlane(double _a, double _b, double _c, double _d, double _weight)
+		{
+			a2 += _a * _a * _weight; ab += _a * _b * _weight; ac += _a * _c * _weight; ad += _a * _d * _weight;
+			b2 += _b * _b * _weight; bc += _b * _c * _weight; bd += _b * _d * _weight;
+			c2 += _c * _c * _weight; cd += _c * _d * _weight;
+			d2 += _d * _d * _weight;
+
+			weight += _weight;
+		}
+
+		void Add(const Quadric& _other)
+		{
+			a2 += _other.a2; ab += _other.ab; ac += _other.ac; ad += _other.ad;
+			b2 += _other.b2; bc += _other.bc; bd += _other.bd;
+			c2 += _other.c2; cd += _other.cd;
+			d2 += _other.d2;
+
+			weight += _other.weight;
+		}
+
+		/// Mean squared distance of _position to the planes.
+		double Evaluate(const Float3& _position) const
+		{
+			const double x = _position.x;
+			const double y = _position.y;
+			const double z = _position.z;
+
+			const double error = a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x +
+				b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y +
+				c2 * z * z + 2.0 * cd * z +
+				d2;
+
+			return weight > 0.0 ? std::abs(error) / weight : 0.0;
+		}
+	};
+
+	Float3 Sub(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{ _lhs.x - _rhs.x, _lhs.y - _rhs.y, _lhs.z - _rhs.z };
+	}
+
+	Float3 Cross(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{
+			_lhs.y * _rhs.z - _lhs.z * _rhs.y,
+			_lhs.z * _rhs.x - _lhs.x * _rhs.z,
+			_lhs.x * _rhs.y - _lhs.y * _rhs.x,
+		};
+	}
+
+	float Dot(const Float3& _lhs, const Float3& _rhs)
+	{
+		return _lhs.x * _rhs.x + _lhs.y * _rhs.y + _lhs.z * _rhs.z;
+	}
+
+	float SquaredDistance(const Float3& _lhs, const Float3& _rhs)
+	{
+		const Float3 diff = Sub(_lhs, _rhs);
+		return Dot(diff, diff);
+	}
+
+	/// Tangents: direction and handedness.
+	float SquaredDistance(const Float4& _lhs, const Float4& _rhs)
+	{
+		const float dw = _lhs.w - _rhs.w;
+		return SquaredDistance(Float3{ _lhs.x, _lhs.y, _lhs.z }, Float3{ _rhs.x, _rhs.y, _rhs.z }) + dw * dw;
+	}
+
+
+	/**
+	* Vertex -> triangles adjacency of the current index list (triangles of vertex v are in [offsets[v], offsets[v + 1])).
+	*/
+	struct TriangleAdjacency
+	{
+		std::vector<uint32_t> offsets;
+		std::vector<uint32_t> triangles;
+
+		void Build(const std::vector<uint32_t>& _indices, uint32_t _vertexNum)
+		{
+			offsets.assign(_vertexNum + 1, 0u);
+			triangles.resize(_indices.size());
+
+			for (uint32_t index : _indices)
+				++offsets[index + 1];
+
+			for (uint32_t v = 0; v < _vertexNum; ++v)
+				offsets[v + 1] += offsets[v];
+
+			std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+
+			for (size_t i = 0; i < _indices.size(); ++i)
+				triangles[fill[_indices[i]]++] = static_cast<uint32_t>(i / 3);
+		}
+	};
+
+
+	/**
+	* Vertex classification: collapses never move a locked vertex (it can still be a collapse target).
+	*/
+	std::vector<bool> ComputeLockedVertices(const Float3* _positions, uint32_t _vertexNum, const uint32_t* _indices, uint32_t _indexNum)
+	{
+		// Group vertices sharing the same position (attribute seams).
+		std::vector<uint32_t> sorted(_vertexNum);
+
+		for (uint32_t v = 0; v < _vertexNum; ++v)
+			sorted[v] = v;
+
+		auto less = [_positions](uint32_t _lhs, uint32_t _rhs)
+		{
+			const Float3& lhs = _positions[_lhs];
+			const Float3& rhs = _positions[_rhs];
+
+			if (lhs.x != rhs.x)
+				return lhs.x < rhs.x;
+
+			if (lhs.y != rhs.y)
+				return lhs.y < rhs.y;
+
+			return lhs.z < rhs.z;
+		};
+
+		std::sort(sorted.begin(), sorted.end(), less);
+
+		std::vector<uint32_t> wedges(_vertexNum);
+		std::vector<bool> locked(_vertexNum, false);
+
+		for (uint32_t begin = 0; begin < _vertexNum;)
+		{
+			uint32_t end = begin + 1;
+
+			while (end < _vertexNum && !less(sorted[begin], sorted[end]))
+				++end;
+
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				wedges[sorted[i]] = sorted[begin];
+				locked[sorted[i]] = end - begin > 1;
+			}
+
+			begin = end;
+		}
+
+		// Open borders: edges (in position space) without opposite edge.
+		auto edgeKey = [](uint32_t _from, uint32_t _to)
+		{
+			return (static_cast<uint64_t>(_from) << 32) | _to;
+		};
+
+		std::unordered_set<uint64_t> edges;
+		edges.reserve(_indexNum);
+
+		for (uint32_t i = 0; i < _indexNum; i += 3)
+		{
+			for (uint32_t j = 0; j < 3; ++j)
+				edges.insert(edgeKey(wedges[_indices[i + j]], wedges[_indices[i + (j + 1) % 3]]));
+		}
+
+		for (uint32_t i = 0; i < _indexNum; i += 3)
+		{
+			for (uint32_t j = 0; j < 3; ++j)
+			{
+				const uint32_t from = _indices[i + j];
+				const uint32_t to = _indices[i + (j + 1) % 3];
+
+				if (!edges.contains(edgeKey(wedges[to], wedges[from])))
+				{
+					locked[from] = true;
+					locked[to] = true;
+				}
+			}
+		}
+
+		return locked;
+	}
+
+
+	struct Collapse
+	{
+		uint32_t from = 0u;
+		uint32_t to = 0u;
+
+		double geometricError = 0.0;
+		double cost = 0.0;
+	};
+
+	/**
+	* True if moving _from onto _to flips or degenerates any remaining triangle around _from.
+	*/
+	bool IsCollapseFlipping(const Float3* _positions, const std::vector<uint32_t>& _indices, const TriangleAdjacency& _adjacency, uint32_t _from, uint32_t _to)
+	{
+		for (uint32_t i = _adjacency.offsets[_from]; i < _adjacency.offsets[_from + 1]; ++i)
+		{
+			const uint32_t* const triangle = &_indices[_adjacency.triangles[i] * 3];
+
+			// Removed by the collapse.
+			if (triangle[0] == _to || triangle[1] == _to || triangle[2] == _to)
+				continue;
+
+			Float3 corners[3] = { _positions[triangle[0]], _positions[triangle[1]], _positions[triangle[2]] };
+
+			const Float3 oldNormal = Cross(Sub(corners[1], corners[0]), Sub(corners[2], corners[0]));
+
+			for (uint32_t j = 0; j < 3; ++j)
+			{
+				if (triangle[j] == _from)
+					corners[j] = _positions[_to];
+			}
+
+			const Float3 newNormal = Cross(Sub(corners[1], corners[0]), Sub(corners[2], corners[0]));
+
+			// Reject flips and slivers (more than ~75 degrees rotation).
+			if (Dot(oldNormal, newNormal) <= 0.25f * std::sqrt(Dot(oldNormal, oldNormal) * Dot(newNormal, newNormal)))
+				return true;
+		}
+
+		return false;
+	}
+}
+
+
+uint32_t SimplifySubmesh(const MeshData& _mesh, const Submesh& _submesh,
+	const uint32_t* _indices, uint32_t _indexNum,
+	uint32_t _targetIndexNum, float _maxError, const LODSettings& _settings,
+	uint32_t* _outIndices, float& _outError)
+{
+	const uint32_t vertexNum = _submesh.vertexNum;
+
+	// Work in normalized space: errors are relative to the submesh extent.
+	const MeshBounds bounds = ComputeBounds(_mesh.positions.data() + _submesh.baseVertex, vertexNum);
+	const float extent = (std::max)({ bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z, 1e-20f });
+
+	std::vector<Float3> positions(vertexNum);
+
+	for (uint32_t v = 0; v < vertexNum; ++v)
+	{
+		const Float3& position = _mesh.positions[_submesh.baseVertex + v];
+		positions[v] = Float3{ (position.x - bounds.min.x) / extent, (position.y - bounds.min.y) / extent, (position.z - bounds.min.z) / extent };
+	}
+
+	const Float3* const normals = _mesh.normals.data() + _submesh.baseVertex;
+	const Float4* const tangents = _mesh.tangents.data() + _submesh.baseVertex;
+	const Float2* const uvs = _mesh.uvs.data() + _submesh.baseVertex;
+
+	const std::vector<bool> locked = ComputeLockedVertices(positions.data(), vertexNum, _indices, _indexNum);
+
+	std::vector<Quadric> quadrics(vertexNum);
+
+	for (uint32_t i = 0; i < _indexNum; i += 3)
+	{
+		const Float3& p0 = positions[_indices[i]];
+		const Float3 normal = Cross(Sub(positions[_indices[i + 1]], p0), Sub(positions[_indices[i + 2]], p0));
+		const float length = std::sqrt(Dot(normal, normal));
+
+		if (length == 0.0f)
+			continue;
+
+		const Float3 plane{ normal.x / length, normal.y / length, normal.z / length };
+
+		Quadric quadric;
+		quadric.AddPlane(plane.x, plane.y, plane.z, -Dot(plane, p0), length * 0.5f);
+
+		for (uint32_t j = 0; j < 3; ++j)
+			quadrics[_indices[i + j]].Add(quadric);
+	}
+
+	auto attributePenalty = [&](uint32_t _from, uint32_t _to)
+	{
+		const float uvDistance = (uvs[_from].x - uvs[_to].x) * (uvs[_from].x - uvs[_to].x) + (uvs[_from].y - uvs[_to].y) * (uvs[_from].y - uvs[_to].y);
+
+		return _settings.normalWeight * _settings.normalWeight * SquaredDistance(normals[_from], normals[_to]) +
+			_settings.uvWeight * _settings.uvWeight * uvDistance +
+			_settings.tangentWeight * _settings.tangentWeight * SquaredDistance(tangents[_from], tangents[_to]);
+	};
+
+	const double maxCost = static_cast<double>(_maxError) * _maxError;
+
+	std::vector<uint32_t> indices(_indices, _indices + _indexNum);
+	std::vector<uint32_t> remap(vertexNum);
+	std::vector<bool> touched(vertexNum);
+	std::vector<Collapse> collapses;
+	TriangleAdjacency adjacency;
+
+	double resultError = 0.0;
+
+	// Passes of independent collapses (no shared triangle), cheapest first.
+	while (indices.size() > _targetIndexNum)
+	{
+		collapses.clear();
+
+		for (size_t i = 0; i < indices.size(); i += 3)
+		{
+			for (uint32_t j = 0; j < 3; ++j)
+			{
+				const uint32_t v0 = indices[i + j];
+				const uint32_t v1 = indices[i + (j + 1) % 3];
+
+				// Interior edges are shared by 2 triangles: consider each once.
+				if (v0 > v1)
+					continue;
+
+				for (const auto& [from, to] : { std::pair{ v0, v1 }, std::pair{ v1, v0 } })
+				{
+					if (locked[from])
+						continue;
+
+					Quadric quadric = quadrics[from];
+					quadric.Add(quadrics[to]);
+
+					const double geometricError = quadric.Evaluate(positions[to]);
+
+					collapses.push_back(Collapse{
+						.from = from,
+						.to = to,
+						.geometricError = geometricError,
+						.cost = geometricError + attributePenalty(from, to),
+					});
+				}
+			}
+		}
+
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& _lhs, const Collapse& _rhs) { return _lhs.cost < _rhs.cost; });
+
+		adjacency.Build(indices, vertexNum);
+
+		for (uint32_t v = 0; v < vertexNum; ++v)
+			remap[v] = v;
+
+		touched.assign(vertexNum, false);
+
+		// Each collapse removes 2 triangles on a manifold.
+		const size_t triangleBudget = (indices.size() - _targetIndexNum) / 3;
+		size_t removedTriangleNum = 0u;
+
+		for (const Collapse& collapse : collapses)
+		{
+			if (collapse.cost > maxCost || removedTriangleNum >= triangleBudget)
+				break;
+
+			if (touched[collapse.from] || touched[collapse.to])
+				continue;
+
+			if (IsCollapseFlipping(positions.data(), indices, adjacency, collapse.from, collapse.to))
+				continue;
+
+			remap[collapse.from] = collapse.to;
+			quadrics[collapse.to].Add(quadrics[collapse.from]);
+
+			// Triangles around 'from' change: their vertices can't collapse again in this pass.
+			for (uint32_t i = adjacency.offsets[collapse.from]; i < adjacency.offsets[collapse.from + 1]; ++i)
+			{
+				const uint32_t* const triangle = &indices[adjacency.triangles[i] * 3];
+
+				touched[triangle[0]] = true;
+				touched[triangle[1]] = true;
+				touched[triangle[2]] = true;
+			}
+
+			resultError = (std::max)(resultError, collapse.geometricError);
+			removedTriangleNum += 2u;
+		}
+
+		if (removedTriangleNum == 0u)
+			break;
+
+		// Apply collapses, remove degenerate triangles.
+		size_t writeIndex = 0u;
+
+		for (size_t i = 0; i < indices.size(); i += 3)
+		{
+			const uint32_t v0 = remap[indices[i]];
+			const uint32_t v1 = remap[indices[i + 1]];
+			const uint32_t v2 = remap[indices[i + 2]];
+
+			if (v0 == v1 || v1 == v2 || v2 == v0)
+				continue;
+
+			indices[writeIndex++] = v0;
+			indices[writeIndex++] = v1;
+			indices[writeIndex++] = v2;
+		}
+
+		indices.resize(writeIndex);
+	}
+
+	std::copy(indices.begin(), indices.end(), _outIndices);
+
+	_outError = static_cast<float>(std::sqrt(resultError)) * extent;
+
+	return static_cast<uint32_t>(indices.size());
+}
+
+
+void BuildMeshLODs(MeshData& _mesh, const LODSettings& _settings)
+{
+	_mesh.lods.clear();
+
+	for (Submesh& submesh : _mesh.submeshes)
+	{
+		submesh.lodOffset = static_cast<uint32_t>(_mesh.lods.size());
+		submesh.lodNum = 0u;
+
+		// Copy: _mesh.indices grows with each level.
+		const std::vector<uint32_t> sourceIndices(_mesh.indices.begin() + submesh.indexOffset, _mesh.indices.begin() + submesh.indexOffset + submesh.indexNum);
+
+		std::vector<uint32_t> lodIndices(sourceIndices.size());
+
+		uint32_t previousIndexNum = submesh.indexNum;
+		float targetRatio = 1.0f;
+
+		for (uint32_t level = 1; level <= _settings.lodNum; ++level)
+		{
+			targetRatio *= _settings.triangleRatio;
+
+			// Always restart from LOD 0: quadrics measure the error to the original surface.
+			const uint32_t targetIndexNum = static_cast<uint32_t>(static_cast<float>(submesh.indexNum / 3) * targetRatio) * 3;
+
+			float error = 0.0f;
+			const uint32_t indexNum = SimplifySubmesh(_mesh, submesh, sourceIndices.data(), submesh.indexNum,
+				targetIndexNum, _settings.maxError, _settings, lodIndices.data(), error);
+
+			// Not worth a level: error limit reached.
+			if (indexNum == 0u || indexNum > previousIndexNum * 9 / 10)
+				break;
+
+			OptimizeVertexCache(lodIndices.data(), indexNum, submesh.vertexNum);
+
+			_mesh.lods.push_back(MeshLOD{
+				.indexOffset = static_cast<uint32_t>(_mesh.indices.size()),
+				.indexNum = indexNum,
+				.error = error,
+			});
+
+			_mesh.indices.insert(_mesh.indices.end(), lodIndices.begin(), lodIndices.begin() + indexNum);
+
+			++submesh.lodNum;
+			previousIndexNum = indexNum;
+		}
+	}
+}
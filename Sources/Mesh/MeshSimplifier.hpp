@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Mesh simplification for automatic LOD generation, run at cook time (see MeshCooker).
+* Quadric error metric edge collapses (Garland, Heckbert 1997) restricted to existing vertices:
+* every LOD reuses the submesh vertex buffer and only adds an index range.
+* Attribute-aware: collapsing across normal / UV / tangent discontinuities is penalized,
+* seam vertices (same position, different attributes) and open borders are locked to keep the mesh crack-free.
+*/
+
+struct LODSettings
+{
+	/// Number of simplified levels generated per submesh (LOD 1 to lodNum).
+	uint32_t lodNum = 3u;
+
+	/// Target triangle count of each level, relative to the previous one.
+	float triangleRatio = 0.5f;
+
+	/// Max error of any level, relative to the submesh bounds extent: simplification stops before reaching it.
+	float maxError = 0.02f;
+
+	/// Attribute penalty weights (attributes are compared as unit vectors / UV coordinates).
+	float normalWeight = 0.02f;
+	float uvWeight = 0.02f;
+	float tangentWeight = 0.01f;
+};
+
+
+/**
+* Simplify the triangle list of _submesh down to _targetIndexNum indices (or less), without exceeding _maxError.
+* _indices / _outIndices are relative to the submesh baseVertex, _outIndices must hold _indexNum indices.
+* _outError: geometric error of the result, in mesh units.
+* Return the simplified index count.
+*/
+uint32_t SimplifySubmesh(const MeshData& _mesh, const Submesh& _submesh,
+	const uint32_t* _indices, uint32_t _indexNum,
+	uint32_t _targetIndexNum, float _maxError, const LODSettings& _settings,
+	uint32_t* _outIndices, float& _outError);
+
+/**
+* Generate LODs of every submesh: fill lods and submeshes LOD ranges, append LOD indices to the index buffer.
+* Run after OptimizeMesh(): LODs indices are optimized for the vertex cache, vertices keep their fetch order.
+* Stop early when a level doesn't remove enough triangles (error limit reached).
+*/
+void BuildMeshLODs(MeshData& _mesh, const LODSettings& _settings = LODSettings{});
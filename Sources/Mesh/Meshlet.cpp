@@ -0,0 +1,203 @@
+#include "Mesh/Meshlet.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+	constexpr uint8_t invalidLocalIndex = 0xFF;
+
+	Float3 Sub(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{ _lhs.x - _rhs.x, _lhs.y - _rhs.y, _lhs.z - _rhs.z };
+	}
+
+	Float3 Cross(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{
+			_lhs.y * _rhs.z - _lhs.z * _rhs.y,
+			_lhs.z * _rhs.x - _lhs.x * _rhs.z,
+			_lhs.x * _rhs.y - _lhs.y * _rhs.x,
+		};
+	}
+
+	float Dot(const Float3& _lhs, const Float3& _rhs)
+	{
+		return _lhs.x * _rhs.x + _lhs.y * _rhs.y + _lhs.z * _rhs.z;
+	}
+
+	float Length(const Float3& _vec)
+	{
+		return std::sqrt(Dot(_vec, _vec));
+	}
+
+
+	/**
+	* Compute bounding sphere and normal cone of _meshlet.
+	* _positions: submesh positions (indexed by meshlet vertices).
+	*/
+	void ComputeMeshletBounds(const MeshData& _mesh, const Float3* _positions, Meshlet& _meshlet)
+	{
+		const uint32_t* const vertices = _mesh.meshletVertices.data() + _meshlet.vertexOffset;
+
+		// Sphere centered on the AABB: cheap and tight enough for small clusters.
+		const MeshBounds bounds = [&]()
+		{
+			MeshBounds result{ .min = _positions[vertices[0]], .max = _positions[vertices[0]] };
+
+			for (uint32_t i = 1; i < _meshlet.vertexNum; ++i)
+			{
+				const Float3& position = _positions[vertices[i]];
+
+				result.min = Float3{ (std::min)(result.min.x, position.x), (std::min)(result.min.y, position.y), (std::min)(result.min.z, position.z) };
+				result.max = Float3{ (std::max)(result.max.x, position.x), (std::max)(result.max.y, position.y), (std::max)(result.max.z, position.z) };
+			}
+
+			return result;
+		}();
+
+		_meshlet.center = Float3{ (bounds.min.x + bounds.max.x) * 0.5f, (bounds.min.y + bounds.max.y) * 0.5f, (bounds.min.z + bounds.max.z) * 0.5f };
+		_meshlet.radius = 0.0f;
+
+		for (uint32_t i = 0; i < _meshlet.vertexNum; ++i)
+			_meshlet.radius = (std::max)(_meshlet.radius, Length(Sub(_positions[vertices[i]], _meshlet.center)));
+
+
+		// Normal cone: average of the triangle normals, opening given by the most divergent one.
+		std::vector<Float3> normals;
+		normals.reserve(_meshlet.triangleNum);
+
+		Float3 axis;
+
+		for (uint32_t i = 0; i < _meshlet.triangleNum; ++i)
+		{
+			const uint32_t packed = _mesh.meshletTriangles[_meshlet.triangleOffset + i];
+
+			const Float3& p0 = _positions[vertices[packed & 0x3FF]];
+			const Float3& p1 = _positions[vertices[(packed >> 10) & 0x3FF]];
+			const Float3& p2 = _positions[vertices[(packed >> 20) & 0x3FF]];
+
+			const Float3 normal = Cross(Sub(p1, p0), Sub(p2, p0));
+			const float length = Length(normal);
+
+			// Degenerate triangles are never visible.
+			if (length == 0.0f)
+				continue;
+
+			const Float3& unitNormal = normals.emplace_back(Float3{ normal.x / length, normal.y / length, normal.z / length });
+
+			axis = Float3{ axis.x + unitNormal.x, axis.y + unitNormal.y, axis.z + unitNormal.z };
+		}
+
+		const float axisLength = Length(axis);
+
+		_meshlet.coneAxis = axisLength > 0.0f ? Float3{ axis.x / axisLength, axis.y / axisLength, axis.z / axisLength } : Float3{ 0.0f, 0.0f, 1.0f };
+		_meshlet.coneCutoff = 1.0f;
+
+		if (axisLength == 0.0f)
+			return;
+
+		float minDot = 1.0f;
+
+		for (const Float3& normal : normals)
+			minDot = (std::min)(minDot, Dot(normal, _meshlet.coneAxis));
+
+		// Cone wider than ~84 degrees: culling would almost never succeed.
+		if (minDot <= 0.1f)
+			return;
+
+		// sin(cone half angle): the cone of back-facing view directions is the normal cone widened by 90 degrees.
+		_meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+	}
+}
+
+
+uint32_t PackMeshletTriangle(uint32_t _i0, uint32_t _i1, uint32_t _i2)
+{
+	return (_i0 & 0x3FF) | ((_i1 & 0x3FF) << 10) | ((_i2 & 0x3FF) << 20);
+}
+
+void BuildMeshlets(MeshData& _mesh)
+{
+	_mesh.meshlets.clear();
+	_mesh.meshletVertices.clear();
+	_mesh.meshletTriangles.clear();
+
+	_mesh.meshletTriangles.reserve(_mesh.indices.size() / 3);
+
+	// Submesh vertex -> meshlet-local index.
+	std::vector<uint8_t> localIndices;
+
+	for (Submesh& submesh : _mesh.submeshes)
+	{
+		submesh.meshletOffset = static_cast<uint32_t>(_mesh.meshlets.size());
+
+		const Float3* const positions = _mesh.positions.data() + submesh.baseVertex;
+		const uint32_t* const indices = _mesh.indices.data() + submesh.indexOffset;
+
+		localIndices.assign(submesh.vertexNum, invalidLocalIndex);
+
+		Meshlet meshlet{
+			.vertexOffset = static_cast<uint32_t>(_mesh.meshletVertices.size()),
+			.triangleOffset = submesh.indexOffset / 3,
+		};
+
+		auto flush = [&]()
+		{
+			if (meshlet.triangleNum == 0u)
+				return;
+
+			ComputeMeshletBounds(_mesh, positions, meshlet);
+
+			for (uint32_t i = 0; i < meshlet.vertexNum; ++i)
+				localIndices[_mesh.meshletVertices[meshlet.vertexOffset + i]] = invalidLocalIndex;
+
+			_mesh.meshlets.push_back(meshlet);
+
+			meshlet = Meshlet{
+				.vertexOffset = static_cast<uint32_t>(_mesh.meshletVertices.size()),
+				.triangleOffset = meshlet.triangleOffset + meshlet.triangleNum,
+			};
+		};
+
+		for (uint32_t i = 0; i < submesh.indexNum; i += 3)
+		{
+			const uint32_t triangle[3] = { indices[i], indices[i + 1], indices[i + 2] };
+
+			uint32_t newVertexNum = 0u;
+
+			for (uint32_t j = 0; j < 3; ++j)
+			{
+				if (localIndices[triangle[j]] == invalidLocalIndex)
+					++newVertexNum;
+			}
+
+			if (meshlet.vertexNum + newVertexNum > meshletMaxVertices || meshlet.triangleNum == meshletMaxTriangles)
+				flush();
+
+			for (uint32_t j = 0; j < 3; ++j)
+			{
+				if (localIndices[triangle[j]] == invalidLocalIndex)
+				{
+					localIndices[triangle[j]] = static_cast<uint8_t>(meshlet.vertexNum++);
+					_mesh.meshletVertices.push_back(triangle[j]);
+				}
+			}
+
+			_mesh.meshletTriangles.push_back(PackMeshletTriangle(localIndices[triangle[0]], localIndices[triangle[1]], localIndices[triangle[2]]));
+			++meshlet.triangleNum;
+		}
+
+		flush();
+
+		submesh.meshletNum = static_cast<uint32_t>(_mesh.meshlets.size()) - submesh.meshletOffset;
+	}
+}
+
+bool IsMeshletBackfacing(const Meshlet& _meshlet, const Float3& _cameraPosition)
+{
+	const Float3 toCenter = Sub(_meshlet.center, _cameraPosition);
+
+	// Conservative for any point of the bounding sphere.
+	return Dot(toCenter, _meshlet.coneAxis) >= _meshlet.coneCutoff * Length(toCenter) + _meshlet.radius;
+}
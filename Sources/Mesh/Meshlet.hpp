@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Meshlets (clusters) for cluster culling and mesh shader pipelines.
+* Limits follow the D3D12 mesh shader recommendations: 64 vertices / 124 triangles fit one 128 threads group output.
+*/
+
+constexpr uint32_t meshletMaxVertices = 64u;
+constexpr uint32_t meshletMaxTriangles = 124u;
+
+
+/**
+* Split every submesh of _mesh into meshlets, filling meshlets, meshletVertices, meshletTriangles and submeshes meshlet ranges.
+* Triangles are scanned in index buffer order: run after OptimizeMesh() so consecutive triangles share vertices.
+* The index buffer is left untouched.
+*/
+void BuildMeshlets(MeshData& _mesh);
+
+/// Pack 3 meshlet-local indices in 10:10:10 bits.
+uint32_t PackMeshletTriangle(uint32_t _i0, uint32_t _i1, uint32_t _i2);
+
+/**
+* Normal cone test: true if every triangle of _meshlet faces away from _cameraPosition.
+* _cameraPosition is in mesh space.
+*/
+bool IsMeshletBackfacing(const Meshlet& _meshlet, const Float3& _cameraPosition);
@@ -0,0 +1,671 @@
+#include "Mesh/ObjLoader.hpp"
+
+#include "Core/MappedFile.hpp"
+#include "Core/ParallelFor.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+namespace
+{
+	/// Parallel task granularity (chunks end on a line boundary).
+	constexpr size_t chunkSize = 1u << 20;
+	constexpr uint32_t vertexBlockSize = 1u << 16;
+
+	constexpr uint32_t invalidIndex = ~0u;
+
+
+//{ Text
+
+	bool IsSpace(char _char)
+	{
+		return _char == ' ' || _char == '\t';
+	}
+
+	bool IsDigit(char _char)
+	{
+		return _char >= '0' && _char <= '9';
+	}
+
+	const char* SkipSpaces(const char* _cursor, const char* _end)
+	{
+		while (_cursor < _end && IsSpace(*_cursor))
+			++_cursor;
+
+		return _cursor;
+	}
+
+	/// Return the start of the next line (or _end).
+	const char* NextLine(const char* _cursor, const char* _end)
+	{
+		const void* const newLine = std::memchr(_cursor, '\n', static_cast<size_t>(_end - _cursor));
+		return newLine ? static_cast<const char*>(newLine) + 1 : _end;
+	}
+
+	enum class LineType
+	{
+		Other,
+		Position,
+		UV,
+		Normal,
+		Face,
+	};
+
+	/// Read the keyword of the line starting at _cursor, move _cursor after it.
+	LineType ReadKeyword(const char*& _cursor, const char* _end)
+	{
+		const char* p = SkipSpaces(_cursor, _end);
+		LineType type = LineType::Other;
+
+		if (_end - p >= 2 && IsSpace(p[1]))
+		{
+			if (p[0] == 'v')
+				type = LineType::Position;
+			else if (p[0] == 'f')
+				type = LineType::Face;
+
+			p += 1;
+		}
+		else if (_end - p >= 3 && p[0] == 'v' && IsSpace(p[2]))
+		{
+			if (p[1] == 't')
+				type = LineType::UV;
+			else if (p[1] == 'n')
+				type = LineType::Normal;
+
+			p += 2;
+		}
+
+		_cursor = p;
+
+		return type;
+	}
+
+
+	/**
+	* SWAR digit parsing (Lemire, "Fast number parsing"): 8 ASCII digits loaded as a little-endian 64-bit word.
+	*/
+	bool IsEightDigits(uint64_t _chars)
+	{
+		return (((_chars & 0xF0F0F0F0F0F0F0F0ull) | (((_chars + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull);
+	}
+
+	uint32_t ParseEightDigits(uint64_t _chars)
+	{
+		constexpr uint64_t mask = 0x000000FF000000FFull;
+		constexpr uint64_t mul1 = 0x000F424000000064ull; // 100 + (1000000 << 32)
+		constexpr uint64_t mul2 = 0x0000271000000001ull; // 1 + (10000 << 32)
+
+		_chars -= 0x3030303030303030ull;
+		_chars = (_chars * 10) + (_chars >> 8); // 2 digits per byte pair.
+		_chars = (((_chars & mask) * mul1) + (((_chars >> 16) & mask) * mul2)) >> 32;
+
+		return static_cast<uint32_t>(_chars);
+	}
+
+	constexpr double powersOf10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+	};
+
+	/**
+	* Parse [+-]digits[.digits][(e|E)[+-]digits].
+	* Clinger fast path when the mantissa and the power of 10 are exact doubles (mantissa <= 2^53, about 15 significant digits,
+	* and |exponent| <= 22), which covers OBJ exporters output: a single exactly rounded multiplication or division.
+	* Other numbers fall back to strtod.
+	*/
+	bool ParseFloat(const char*& _cursor, const char* _end, float& _out)
+	{
+		const char* p = SkipSpaces(_cursor, _end);
+		const char* const start = p;
+
+		bool bNegative = false;
+
+		if (p < _end && (*p == '-' || *p == '+'))
+		{
+			bNegative = *p == '-';
+			++p;
+		}
+
+		constexpr uint32_t maxDigitNum = 19u;
+
+		uint64_t mantissa = 0u;
+		uint32_t digitNum = 0u;
+		int32_t exponent = 0;
+
+		auto readDigits = [&](bool _bFraction)
+		{
+			const char* const start = p;
+
+			while (_end - p >= 8 && digitNum + 8 <= maxDigitNum)
+			{
+				uint64_t chars;
+				std::memcpy(&chars, p, sizeof(chars));
+
+				if (!IsEightDigits(chars))
+					break;
+
+				mantissa = mantissa * 100000000u + ParseEightDigits(chars);
+				digitNum += 8u;
+				exponent -= _bFraction ? 8 : 0;
+				p += 8;
+			}
+
+			for (; p < _end && IsDigit(*p); ++p)
+			{
+				if (digitNum < maxDigitNum)
+				{
+					mantissa = mantissa * 10u + static_cast<uint32_t>(*p - '0');
+					++digitNum;
+					exponent -= _bFraction ? 1 : 0;
+				}
+				else if (!_bFraction)
+					++exponent; // Dropped integer digit.
+			}
+
+			return p != start;
+		};
+
+		bool bHasDigits = readDigits(false);
+
+		if (p < _end && *p == '.')
+		{
+			++p;
+			bHasDigits |= readDigits(true);
+		}
+
+		if (!bHasDigits)
+			return false;
+
+		if (p < _end && (*p == 'e' || *p == 'E'))
+		{
+			++p;
+
+			bool bNegativeExponent = false;
+
+			if (p < _end && (*p == '-' || *p == '+'))
+			{
+				bNegativeExponent = *p == '-';
+				++p;
+			}
+
+			int32_t value = 0;
+
+			for (; p < _end && IsDigit(*p); ++p)
+				value = (std::min)(value * 10 + (*p - '0'), 100000);
+
+			exponent += bNegativeExponent ? -value : value;
+		}
+
+		double value = static_cast<double>(mantissa);
+
+		if (mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22)
+		{
+			if (exponent < 0)
+				value /= powersOf10[-exponent];
+			else
+				value *= powersOf10[exponent];
+		}
+		else
+		{
+			// Mapped file data isn't null-terminated: copy the number.
+			char buffer[128];
+			const size_t length = (std::min)(static_cast<size_t>(p - start), sizeof(buffer) - 1);
+
+			std::memcpy(buffer, start, length);
+			buffer[length] = '\0';
+
+			value = std::fabs(std::strtod(buffer, nullptr));
+		}
+
+		_out = static_cast<float>(bNegative ? -value : value);
+		_cursor = p;
+
+		return true;
+	}
+
+	bool ParseIndex(const char*& _cursor, const char* _end, int64_t& _out)
+	{
+		const char* p = _cursor;
+
+		const bool bNegative = p < _end && *p == '-';
+
+		if (bNegative)
+			++p;
+
+		if (p >= _end || !IsDigit(*p))
+			return false;
+
+		int64_t value = 0;
+
+		for (; p < _end && IsDigit(*p); ++p)
+			value = (std::min)(value * 10 + (*p - '0'), int64_t(1) << 40);
+
+		_out = bNegative ? -value : value;
+		_cursor = p;
+
+		return true;
+	}
+
+	/**
+	* OBJ indices are 1-based, negative indices are relative to the current attribute count.
+	*/
+	bool ResolveIndex(int64_t _index, uint32_t _countBefore, uint32_t _totalCount, uint32_t& _out)
+	{
+		const int64_t index = _index > 0 ? _index - 1 : static_cast<int64_t>(_countBefore) + _index;
+
+		if (_index == 0 || index < 0 || index >= _totalCount)
+			return false;
+
+		_out = static_cast<uint32_t>(index);
+
+		return true;
+	}
+
+//}
+
+
+//{ Parsing
+
+	struct Corner
+	{
+		uint32_t position = invalidIndex;
+		uint32_t uv = invalidIndex;
+		uint32_t normal = invalidIndex;
+
+		bool operator==(const Corner&) const = default;
+	};
+
+	struct Chunk
+	{
+		const char* begin = nullptr;
+		const char* end = nullptr;
+
+		uint32_t positionNum = 0u;
+		uint32_t uvNum = 0u;
+		uint32_t normalNum = 0u;
+
+		// Index of the first attribute of the chunk in the whole file.
+		uint32_t positionOffset = 0u;
+		uint32_t uvOffset = 0u;
+		uint32_t normalOffset = 0u;
+
+		// Triangulated faces.
+		std::vector<Corner> corners;
+
+		bool bValid = true;
+	};
+
+	/// Raw OBJ attributes, indexed by face corners.
+	struct ObjAttributes
+	{
+		std::vector<Float3> positions;
+		std::vector<Float2> uvs;
+		std::vector<Float3> normals;
+	};
+
+	void CountAttributes(Chunk& _chunk)
+	{
+		for (const char* line = _chunk.begin; line < _chunk.end; line = NextLine(line, _chunk.end))
+		{
+			switch (ReadKeyword(line, _chunk.end))
+			{
+				case LineType::Position:
+					++_chunk.positionNum;
+					break;
+				case LineType::UV:
+					++_chunk.uvNum;
+					break;
+				case LineType::Normal:
+					++_chunk.normalNum;
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	bool ParseFloats(const char*& _cursor, const char* _end, float* _out, uint32_t _requiredNum, uint32_t _maxNum)
+	{
+		uint32_t i = 0u;
+
+		for (; i < _maxNum; ++i)
+		{
+			if (!ParseFloat(_cursor, _end, _out[i]))
+				break;
+		}
+
+		return i >= _requiredNum;
+	}
+
+	bool ParseFace(const char* _cursor, const char* _end, const Chunk& _chunk, uint32_t _positionNum, uint32_t _uvNum, uint32_t _normalNum,
+		const ObjAttributes& _attributes, std::vector<Corner>& _polygon)
+	{
+		_polygon.clear();
+
+		for (_cursor = SkipSpaces(_cursor, _end); _cursor < _end && *_cursor != '\r' && *_cursor != '\n' && *_cursor != '#'; _cursor = SkipSpaces(_cursor, _end))
+		{
+			Corner corner;
+			int64_t index = 0;
+
+			if (!ParseIndex(_cursor, _end, index) ||
+				!ResolveIndex(index, _chunk.positionOffset + _positionNum, static_cast<uint32_t>(_attributes.positions.size()), corner.position))
+				return false;
+
+			if (_cursor < _end && *_cursor == '/')
+			{
+				++_cursor;
+
+				// v/vt or v/vt/vn.
+				if (_cursor < _end && *_cursor != '/')
+				{
+					if (!ParseIndex(_cursor, _end, index) ||
+						!ResolveIndex(index, _chunk.uvOffset + _uvNum, static_cast<uint32_t>(_attributes.uvs.size()), corner.uv))
+						return false;
+				}
+
+				// v//vn or v/vt/vn.
+				if (_cursor < _end && *_cursor == '/')
+				{
+					++_cursor;
+
+					if (!ParseIndex(_cursor, _end, index) ||
+						!ResolveIndex(index, _chunk.normalOffset + _normalNum, static_cast<uint32_t>(_attributes.normals.size()), corner.normal))
+						return false;
+				}
+			}
+
+			_polygon.push_back(corner);
+		}
+
+		return _polygon.size() >= 3;
+	}
+
+	void ParseChunk(Chunk& _chunk, ObjAttributes& _attributes)
+	{
+		uint32_t positionNum = 0u;
+		uint32_t uvNum = 0u;
+		uint32_t normalNum = 0u;
+
+		std::vector<Corner> polygon;
+
+		for (const char* line = _chunk.begin; line < _chunk.end && _chunk.bValid; line = NextLine(line, _chunk.end))
+		{
+			const char* cursor = line;
+			const LineType type = ReadKeyword(cursor, _chunk.end);
+
+			switch (type)
+			{
+				case LineType::Position:
+				{
+					// Optional w / vertex colors are ignored.
+					_chunk.bValid = ParseFloats(cursor, _chunk.end, &_attributes.positions[_chunk.positionOffset + positionNum++].x, 3u, 3u);
+					break;
+				}
+				case LineType::UV:
+				{
+					_chunk.bValid = ParseFloats(cursor, _chunk.end, &_attributes.uvs[_chunk.uvOffset + uvNum++].x, 1u, 2u);
+					break;
+				}
+				case LineType::Normal:
+				{
+					_chunk.bValid = ParseFloats(cursor, _chunk.end, &_attributes.normals[_chunk.normalOffset + normalNum++].x, 3u, 3u);
+					break;
+				}
+				case LineType::Face:
+				{
+					_chunk.bValid = ParseFace(cursor, _chunk.end, _chunk, positionNum, uvNum, normalNum, _attributes, polygon);
+
+					// Fan triangulation (convex polygons).
+					for (size_t i = 2; _chunk.bValid && i < polygon.size(); ++i)
+					{
+						_chunk.corners.push_back(polygon[0]);
+						_chunk.corners.push_back(polygon[i - 1]);
+						_chunk.corners.push_back(polygon[i]);
+					}
+
+					break;
+				}
+				default:
+					break;
+			}
+		}
+	}
+
+//}
+
+
+//{ Vertices
+
+	uint64_t HashCorner(const Corner& _corner)
+	{
+		uint64_t hash = _corner.position * 0x9E3779B97F4A7C15ull;
+		hash ^= _corner.uv * 0xC2B2AE3D27D4EB4Full;
+		hash ^= _corner.normal * 0x165667B19E3779F9ull;
+
+		return hash ^ (hash >> 29);
+	}
+
+	/**
+	* Weld identical corners into unique vertices (open addressing hash table, linear probing).
+	* Fill _outVertices (unique corners) and _outIndices (one per corner), in first-use order.
+	*/
+	void WeldCorners(const std::vector<Chunk>& _chunks, std::vector<Corner>& _outVertices, std::vector<uint32_t>& _outIndices)
+	{
+		size_t cornerNum = 0u;
+
+		for (const Chunk& chunk : _chunks)
+			cornerNum += chunk.corners.size();
+
+		size_t tableSize = 1u;
+
+		while (tableSize < cornerNum * 2)
+			tableSize *= 2;
+
+		std::vector<uint32_t> table(tableSize, invalidIndex);
+
+		_outIndices.reserve(cornerNum);
+
+		for (const Chunk& chunk : _chunks)
+		{
+			for (const Corner& corner : chunk.corners)
+			{
+				size_t slot = HashCorner(corner) & (tableSize - 1);
+
+				while (table[slot] != invalidIndex && !(_outVertices[table[slot]] == corner))
+					slot = (slot + 1) & (tableSize - 1);
+
+				if (table[slot] == invalidIndex)
+				{
+					table[slot] = static_cast<uint32_t>(_outVertices.size());
+					_outVertices.push_back(corner);
+				}
+
+				_outIndices.push_back(table[slot]);
+			}
+		}
+	}
+
+	Float3 Sub(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{ _lhs.x - _rhs.x, _lhs.y - _rhs.y, _lhs.z - _rhs.z };
+	}
+
+	Float3 Cross(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{
+			_lhs.y * _rhs.z - _lhs.z * _rhs.y,
+			_lhs.z * _rhs.x - _lhs.x * _rhs.z,
+			_lhs.x * _rhs.y - _lhs.y * _rhs.x,
+		};
+	}
+
+	float Dot(const Float3& _lhs, const Float3& _rhs)
+	{
+		return _lhs.x * _rhs.x + _lhs.y * _rhs.y + _lhs.z * _rhs.z;
+	}
+
+	Float3 Normalize(const Float3& _vec, const Float3& _fallback)
+	{
+		const float length = std::sqrt(Dot(_vec, _vec));
+		return length > 1e-20f ? Float3{ _vec.x / length, _vec.y / length, _vec.z / length } : _fallback;
+	}
+
+	void AddTo(Float3& _lhs, const Float3& _rhs)
+	{
+		_lhs.x += _rhs.x;
+		_lhs.y += _rhs.y;
+		_lhs.z += _rhs.z;
+	}
+
+	/**
+	* Smooth normals for vertices without OBJ normal: area weighted face normals, shared by position.
+	*/
+	void ComputeMissingNormals(const std::vector<Corner>& _vertices, uint32_t _positionNum, MeshData& _mesh)
+	{
+		std::vector<Float3> positionNormals(_positionNum);
+
+		for (size_t i = 0; i < _mesh.indices.size(); i += 3)
+		{
+			const uint32_t i0 = _mesh.indices[i];
+			const uint32_t i1 = _mesh.indices[i + 1];
+			const uint32_t i2 = _mesh.indices[i + 2];
+
+			const Float3& p0 = _mesh.positions[i0];
+			const Float3 faceNormal = Cross(Sub(_mesh.positions[i1], p0), Sub(_mesh.positions[i2], p0));
+
+			AddTo(positionNormals[_vertices[i0].position], faceNormal);
+			AddTo(positionNormals[_vertices[i1].position], faceNormal);
+			AddTo(positionNormals[_vertices[i2].position], faceNormal);
+		}
+
+		for (size_t v = 0; v < _vertices.size(); ++v)
+		{
+			if (_vertices[v].normal == invalidIndex)
+				_mesh.normals[v] = Normalize(positionNormals[_vertices[v].position], Float3{ 0.0f, 1.0f, 0.0f });
+		}
+	}
+
+//}
+}
+
+
+bool ParseObj(const char* _data, size_t _size, MeshData& _outMesh)
+{
+	const char* const end = _data + _size;
+
+	std::vector<Chunk> chunks;
+
+	for (const char* begin = _data; begin < end;)
+	{
+		const char* const chunkEnd = static_cast<size_t>(end - begin) <= chunkSize ? end : NextLine(begin + chunkSize, end);
+
+		chunks.push_back(Chunk{ .begin = begin, .end = chunkEnd });
+		begin = chunkEnd;
+	}
+
+	// Pass 1: count attributes, to parse each chunk in place.
+	ParallelFor(static_cast<uint32_t>(chunks.size()), [&chunks](uint32_t _chunkIndex)
+	{
+		CountAttributes(chunks[_chunkIndex]);
+	});
+
+	uint32_t positionNum = 0u;
+	uint32_t uvNum = 0u;
+	uint32_t normalNum = 0u;
+
+	for (Chunk& chunk : chunks)
+	{
+		chunk.positionOffset = positionNum;
+		chunk.uvOffset = uvNum;
+		chunk.normalOffset = normalNum;
+
+		positionNum += chunk.positionNum;
+		uvNum += chunk.uvNum;
+		normalNum += chunk.normalNum;
+	}
+
+	ObjAttributes attributes;
+	attributes.positions.resize(positionNum);
+	attributes.uvs.resize(uvNum);
+	attributes.normals.resize(normalNum);
+
+	// Pass 2: parse attributes and faces.
+	ParallelFor(static_cast<uint32_t>(chunks.size()), [&chunks, &attributes](uint32_t _chunkIndex)
+	{
+		ParseChunk(chunks[_chunkIndex], attributes);
+	});
+
+	for (const Chunk& chunk : chunks)
+	{
+		if (!chunk.bValid)
+			return false;
+	}
+
+	std::vector<Corner> vertices;
+	WeldCorners(chunks, vertices, _outMesh.indices);
+
+	if (vertices.empty())
+		return false;
+
+	const uint32_t vertexNum = static_cast<uint32_t>(vertices.size());
+
+	_outMesh.positions.resize(vertexNum);
+	_outMesh.normals.resize(vertexNum);
+	_outMesh.uvs.resize(vertexNum);
+
+	// Left-handed conversion (aiProcess_ConvertToLeftHanded): mirror z, flip v, reverse winding.
+	ParallelFor((vertexNum + vertexBlockSize - 1) / vertexBlockSize, [&](uint32_t _blockIndex)
+	{
+		const uint32_t blockEnd = (std::min)(vertexNum, (_blockIndex + 1) * vertexBlockSize);
+
+		for (uint32_t v = _blockIndex * vertexBlockSize; v < blockEnd; ++v)
+		{
+			const Corner& corner = vertices[v];
+
+			const Float3& position = attributes.positions[corner.position];
+			_outMesh.positions[v] = Float3{ position.x, position.y, -position.z };
+
+			if (corner.normal != invalidIndex)
+			{
+				const Float3& normal = attributes.normals[corner.normal];
+				_outMesh.normals[v] = Normalize(Float3{ normal.x, normal.y, -normal.z }, Float3{ 0.0f, 1.0f, 0.0f });
+			}
+
+			if (corner.uv != invalidIndex)
+			{
+				const Float2& uv = attributes.uvs[corner.uv];
+				_outMesh.uvs[v] = Float2{ uv.x, 1.0f - uv.y };
+			}
+		}
+	});
+
+	for (size_t i = 0; i < _outMesh.indices.size(); i += 3)
+		std::swap(_outMesh.indices[i], _outMesh.indices[i + 2]);
+
+	const bool bMissingNormals = std::any_of(vertices.begin(), vertices.end(), [](const Corner& _corner) { return _corner.normal == invalidIndex; });
+
+	if (bMissingNormals)
+		ComputeMissingNormals(vertices, positionNum, _outMesh);
+
+	_outMesh.submeshes.push_back(Submesh{
+		.indexOffset = 0u,
+		.indexNum = static_cast<uint32_t>(_outMesh.indices.size()),
+		.baseVertex = 0u,
+		.vertexNum = vertexNum,
+	});
+
+	return true;
+}
+
+bool LoadObj(const char* _path, MeshData& _outMesh)
+{
+	MappedFile file;
+
+	if (!file.Open(_path))
+		return false;
+
+	return ParseObj(reinterpret_cast<const char*>(file.GetData()), static_cast<size_t>(file.GetSize()), _outMesh);
+}
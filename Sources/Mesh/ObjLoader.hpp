@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Fast Wavefront OBJ loader (v, vt, vn, f), replacing Assimp for OBJ sources in MeshCooker.
+*
+* - The file is memory-mapped and split in line-aligned chunks parsed in parallel (see ParallelFor):
+*   a first pass counts v / vt / vn per chunk so each chunk writes its attributes at its final offset (no merge copy)
+*   and resolves relative (negative) indices.
+* - Floats are parsed 8 digits at a time (SWAR: SIMD within a 64-bit register).
+* - Face corners (position / uv / normal triplets) are welded by hash into unique vertices.
+* - Polygons are triangulated as fans, missing normals are computed (area weighted).
+*   Tangents are left empty: see GenerateTangents (TangentGenerator.hpp).
+*
+* Output matches Assimp with aiProcess_ConvertToLeftHanded | aiProcess_Triangulate:
+* left-handed (z mirrored), UV origin top-left (v flipped), clockwise winding.
+* The whole file is imported as a single submesh (groups, objects and materials are ignored).
+*/
+
+/// Parse OBJ text in memory.
+bool ParseObj(const char* _data, size_t _size, MeshData& _outMesh);
+
+/// Memory-map and parse an OBJ file.
+bool LoadObj(const char* _path, MeshData& _outMesh);
@@ -0,0 +1,354 @@
+#include "Mesh/TangentGenerator.hpp"
+
+#include "Core/ParallelFor.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+	/// Parallel task granularity.
+	constexpr uint32_t triangleBlockSize = 1u << 14;
+	constexpr uint32_t groupBlockSize = 1u << 14;
+
+	constexpr uint32_t invalidIndex = ~0u;
+
+
+	Float3 Sub(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{ _lhs.x - _rhs.x, _lhs.y - _rhs.y, _lhs.z - _rhs.z };
+	}
+
+	Float3 Scale(const Float3& _vec, float _scale)
+	{
+		return Float3{ _vec.x * _scale, _vec.y * _scale, _vec.z * _scale };
+	}
+
+	void AddTo(Float3& _lhs, const Float3& _rhs)
+	{
+		_lhs.x += _rhs.x;
+		_lhs.y += _rhs.y;
+		_lhs.z += _rhs.z;
+	}
+
+	Float3 Cross(const Float3& _lhs, const Float3& _rhs)
+	{
+		return Float3{
+			_lhs.y * _rhs.z - _lhs.z * _rhs.y,
+			_lhs.z * _rhs.x - _lhs.x * _rhs.z,
+			_lhs.x * _rhs.y - _lhs.y * _rhs.x,
+		};
+	}
+
+	float Dot(const Float3& _lhs, const Float3& _rhs)
+	{
+		return _lhs.x * _rhs.x + _lhs.y * _rhs.y + _lhs.z * _rhs.z;
+	}
+
+	bool TryNormalize(Float3& _vec)
+	{
+		const float length = std::sqrt(Dot(_vec, _vec));
+
+		if (length <= 1e-20f)
+			return false;
+
+		_vec = Scale(_vec, 1.0f / length);
+
+		return true;
+	}
+
+	/// Remove the component of _vec along _normal (unit).
+	Float3 ProjectOnPlane(const Float3& _vec, const Float3& _normal)
+	{
+		return Sub(_vec, Scale(_normal, Dot(_normal, _vec)));
+	}
+
+	/// Any unit vector orthogonal to _normal (tangent of triangles without UV mapping).
+	Float3 GetOrthogonal(const Float3& _normal)
+	{
+		Float3 orthogonal = std::abs(_normal.x) < 0.9f ? Cross(_normal, Float3{ 1.0f, 0.0f, 0.0f }) : Cross(_normal, Float3{ 0.0f, 1.0f, 0.0f });
+
+		if (!TryNormalize(orthogonal))
+			return Float3{ 1.0f, 0.0f, 0.0f };
+
+		return orthogonal;
+	}
+
+
+	/**
+	* Corner contribution to the tangent space of its vertex group.
+	*/
+	struct CornerBasis
+	{
+		// Angle-weighted, in the tangent plane of the vertex normal.
+		Float3 tangent;
+		Float3 bitangent;
+
+		// UV winding matches the triangle winding.
+		bool bOrientationPreserving = true;
+
+		// Zero UV area: no contribution, uses the tangent space of the vertex.
+		bool bDegenerate = false;
+	};
+
+	void ComputeCornerBases(const MeshData& _mesh, std::vector<CornerBasis>& _outCorners)
+	{
+		const uint32_t triangleNum = static_cast<uint32_t>(_mesh.indices.size() / 3);
+
+		_outCorners.resize(_mesh.indices.size());
+
+		ParallelFor((triangleNum + triangleBlockSize - 1) / triangleBlockSize, [&](uint32_t _blockIndex)
+		{
+			const uint32_t blockEnd = (std::min)(triangleNum, (_blockIndex + 1) * triangleBlockSize);
+
+			for (uint32_t t = _blockIndex * triangleBlockSize; t < blockEnd; ++t)
+			{
+				const uint32_t* const triangle = &_mesh.indices[t * 3];
+
+				const Float3& p0 = _mesh.positions[triangle[0]];
+				const Float2& uv0 = _mesh.uvs[triangle[0]];
+
+				const Float3 edge1 = Sub(_mesh.positions[triangle[1]], p0);
+				const Float3 edge2 = Sub(_mesh.positions[triangle[2]], p0);
+
+				const Float2 uvEdge1{ _mesh.uvs[triangle[1]].x - uv0.x, _mesh.uvs[triangle[1]].y - uv0.y };
+				const Float2 uvEdge2{ _mesh.uvs[triangle[2]].x - uv0.x, _mesh.uvs[triangle[2]].y - uv0.y };
+
+				const float signedUVArea = uvEdge1.x * uvEdge2.y - uvEdge1.y * uvEdge2.x;
+				const bool bOrientationPreserving = signedUVArea > 0.0f;
+
+				// Directions of increasing u and v on the triangle, oriented by the UV winding.
+				const float orientationSign = bOrientationPreserving ? 1.0f : -1.0f;
+
+				Float3 faceTangent = Scale(Sub(Scale(edge1, uvEdge2.y), Scale(edge2, uvEdge1.y)), orientationSign);
+				Float3 faceBitangent = Scale(Sub(Scale(edge2, uvEdge1.x), Scale(edge1, uvEdge2.x)), orientationSign);
+
+				const bool bDegenerate = signedUVArea == 0.0f || !TryNormalize(faceTangent) || !TryNormalize(faceBitangent);
+
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					CornerBasis& corner = _outCorners[t * 3 + i];
+
+					corner = CornerBasis{};
+					corner.bOrientationPreserving = bOrientationPreserving;
+					corner.bDegenerate = bDegenerate;
+
+					if (bDegenerate)
+						continue;
+
+					const Float3& normal = _mesh.normals[triangle[i]];
+					const Float3& position = _mesh.positions[triangle[i]];
+
+					Float3 tangent = ProjectOnPlane(faceTangent, normal);
+					Float3 bitangent = ProjectOnPlane(faceBitangent, normal);
+
+					TryNormalize(tangent);
+					TryNormalize(bitangent);
+
+					// Corner angle, measured in the tangent plane.
+					Float3 toPrevious = ProjectOnPlane(Sub(_mesh.positions[triangle[(i + 2) % 3]], position), normal);
+					Float3 toNext = ProjectOnPlane(Sub(_mesh.positions[triangle[(i + 1) % 3]], position), normal);
+
+					float angle = 0.0f;
+
+					if (TryNormalize(toPrevious) && TryNormalize(toNext))
+						angle = std::acos((std::clamp)(Dot(toPrevious, toNext), -1.0f, 1.0f));
+
+					corner.tangent = Scale(tangent, angle);
+					corner.bitangent = Scale(bitangent, angle);
+				}
+			}
+		});
+	}
+
+
+	/**
+	* Vertex identity by value (position, normal, UV): unwelded imports still share tangent spaces.
+	*/
+	struct VertexKey
+	{
+		float values[8];
+
+		bool operator==(const VertexKey& _other) const
+		{
+			return std::memcmp(values, _other.values, sizeof(values)) == 0;
+		}
+	};
+
+	struct VertexKeyHash
+	{
+		size_t operator()(const VertexKey& _key) const
+		{
+			uint32_t bits[8];
+			std::memcpy(bits, _key.values, sizeof(bits));
+
+			uint64_t hash = 0xCBF29CE484222325ull;
+
+			for (uint32_t value : bits)
+				hash = (hash ^ value) * 0x100000001B3ull;
+
+			return static_cast<size_t>(hash ^ (hash >> 32));
+		}
+	};
+
+	std::vector<uint32_t> ComputeCanonicalVertices(const MeshData& _mesh)
+	{
+		const uint32_t vertexNum = static_cast<uint32_t>(_mesh.positions.size());
+
+		std::vector<uint32_t> canonical(vertexNum);
+		std::unordered_map<VertexKey, uint32_t, VertexKeyHash> keys;
+		keys.reserve(vertexNum);
+
+		for (uint32_t v = 0; v < vertexNum; ++v)
+		{
+			const Float3& position = _mesh.positions[v];
+			const Float3& normal = _mesh.normals[v];
+			const Float2& uv = _mesh.uvs[v];
+
+			// +0.0f: -0.0f and 0.0f must compare equal.
+			const VertexKey key{ { position.x + 0.0f, position.y + 0.0f, position.z + 0.0f, normal.x + 0.0f, normal.y + 0.0f, normal.z + 0.0f, uv.x + 0.0f, uv.y + 0.0f } };
+
+			canonical[v] = keys.try_emplace(key, v).first->second;
+		}
+
+		return canonical;
+	}
+
+
+	/// Generate tangents of a single mesh (0-based indices), duplicating vertices with both handedness.
+	void GenerateMeshTangents(MeshData& _mesh)
+	{
+		const uint32_t vertexNum = static_cast<uint32_t>(_mesh.positions.size());
+		const uint32_t cornerNum = static_cast<uint32_t>(_mesh.indices.size());
+
+		std::vector<CornerBasis> corners;
+		ComputeCornerBases(_mesh, corners);
+
+		const std::vector<uint32_t> canonical = ComputeCanonicalVertices(_mesh);
+
+		// Group: same vertex value, same orientation.
+		auto getGroup = [&](uint32_t _corner)
+		{
+			return canonical[_mesh.indices[_corner]] * 2 + (corners[_corner].bOrientationPreserving ? 1u : 0u);
+		};
+
+		// Corners sorted by group (counting sort): groups of corners in [offsets[g], offsets[g + 1]).
+		const uint32_t groupNum = vertexNum * 2;
+
+		std::vector<uint32_t> offsets(groupNum + 1, 0u);
+		std::vector<uint32_t> groupCorners(cornerNum);
+
+		for (uint32_t c = 0; c < cornerNum; ++c)
+		{
+			if (!corners[c].bDegenerate)
+				++offsets[getGroup(c) + 1];
+		}
+
+		for (uint32_t g = 0; g < groupNum; ++g)
+			offsets[g + 1] += offsets[g];
+
+		{
+			std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+
+			for (uint32_t c = 0; c < cornerNum; ++c)
+			{
+				if (!corners[c].bDegenerate)
+					groupCorners[fill[getGroup(c)]++] = c;
+			}
+		}
+
+		// Sum the angle weighted corners of each group.
+		std::vector<Float4> groupTangents(groupNum);
+
+		ParallelFor((groupNum + groupBlockSize - 1) / groupBlockSize, [&](uint32_t _blockIndex)
+		{
+			const uint32_t blockEnd = (std::min)(groupNum, (_blockIndex + 1) * groupBlockSize);
+
+			for (uint32_t g = _blockIndex * groupBlockSize; g < blockEnd; ++g)
+			{
+				if (offsets[g] == offsets[g + 1])
+					continue;
+
+				Float3 tangent;
+
+				for (uint32_t i = offsets[g]; i < offsets[g + 1]; ++i)
+					AddTo(tangent, corners[groupCorners[i]].tangent);
+
+				if (!TryNormalize(tangent))
+					tangent = GetOrthogonal(_mesh.normals[g / 2]);
+
+				groupTangents[g] = Float4{ tangent.x, tangent.y, tangent.z, (g & 1u) ? 1.0f : -1.0f };
+			}
+		});
+
+		// Write vertex tangents: split vertices used by several groups.
+		_mesh.tangents.resize(vertexNum);
+
+		std::vector<uint32_t> vertexGroups(vertexNum, invalidIndex);
+		std::unordered_map<uint64_t, uint32_t> splitVertices;
+
+		for (uint32_t c = 0; c < cornerNum; ++c)
+		{
+			if (corners[c].bDegenerate)
+				continue;
+
+			const uint32_t group = getGroup(c);
+			uint32_t& index = _mesh.indices[c];
+
+			if (vertexGroups[index] == invalidIndex)
+			{
+				vertexGroups[index] = group;
+				_mesh.tangents[index] = groupTangents[group];
+				continue;
+			}
+
+			if (vertexGroups[index] == group)
+				continue;
+
+			const uint64_t splitKey = (static_cast<uint64_t>(index) << 32) | group;
+			const auto [it, bInserted] = splitVertices.try_emplace(splitKey, static_cast<uint32_t>(_mesh.positions.size()));
+
+			if (bInserted)
+			{
+				_mesh.positions.push_back(_mesh.positions[index]);
+				_mesh.normals.push_back(_mesh.normals[index]);
+				_mesh.uvs.push_back(_mesh.uvs[index]);
+				_mesh.tangents.push_back(groupTangents[group]);
+			}
+
+			index = it->second;
+		}
+
+		// Vertices only used by degenerate triangles.
+		for (uint32_t v = 0; v < vertexNum; ++v)
+		{
+			if (vertexGroups[v] == invalidIndex)
+			{
+				const Float3 tangent = GetOrthogonal(_mesh.normals[v]);
+				_mesh.tangents[v] = Float4{ tangent.x, tangent.y, tangent.z, 1.0f };
+			}
+		}
+	}
+}
+
+
+void GenerateTangents(MeshData& _mesh)
+{
+	MeshData result;
+
+	for (const Submesh& submesh : _mesh.submeshes)
+	{
+		MeshData submeshData = ExtractSubmesh(_mesh, submesh);
+
+		GenerateMeshTangents(submeshData);
+
+		AppendSubmesh(result, submeshData);
+	}
+
+	result.bounds = _mesh.bounds;
+	result.sphere = _mesh.sphere;
+
+	_mesh = std::move(result);
+}
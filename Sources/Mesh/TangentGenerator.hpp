@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Tangent space generation following MikkTSpace (Morten Mikkelsen), the convention of most normal map bakers:
+* - per triangle: UV-aligned tangent / bitangent directions and orientation (UV winding) from the triangle UV gradients.
+* - per corner: directions projected in the tangent plane of the vertex normal, weighted by the corner angle.
+* - per vertex: corners sharing the same position, normal, UV and orientation are summed (vertex duplicates are welded by value).
+* - tangent.w: handedness, bitangent = tangent.w * cross(normal, tangent).
+*
+* Triangle and group passes run in parallel (see ParallelFor).
+* Vertices shared by triangles of both orientations (mirrored UVs) are duplicated: each one keeps a single handedness.
+*/
+
+/**
+* Compute _mesh tangents from positions, normals, UVs and indices.
+* Run right after import, before any optimization: duplicated vertices are appended to their submesh range
+* (the mesh is rebuilt submesh by submesh).
+*/
+void GenerateTangents(MeshData& _mesh);
@@ -0,0 +1,116 @@
+#include "Mesh/VertexQuantization.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+namespace
+{
+	float SignNotZero(float _value)
+	{
+		return _value >= 0.0f ? 1.0f : -1.0f;
+	}
+}
+
+uint16_t QuantizeUNorm16(float _value)
+{
+	return static_cast<uint16_t>(std::clamp(_value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+int16_t QuantizeSNorm16(float _value)
+{
+	return static_cast<int16_t>(std::lround(std::clamp(_value, -1.0f, 1.0f) * 32767.0f));
+}
+
+uint16_t FloatToHalf(float _value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &_value, sizeof(bits));
+
+	const uint32_t sign = (bits >> 16) & 0x8000u;
+	const uint32_t floatExponent = (bits >> 23) & 0xFFu;
+	uint32_t mantissa = bits & 0x7FFFFFu;
+
+	// Inf / NaN.
+	if (floatExponent == 0xFFu)
+		return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+
+	const int32_t exponent = static_cast<int32_t>(floatExponent) - 127 + 15;
+
+	// Overflow: Inf.
+	if (exponent >= 31)
+		return static_cast<uint16_t>(sign | 0x7C00u);
+
+	// Denormal half (or zero).
+	if (exponent <= 0)
+	{
+		if (exponent < -10)
+			return static_cast<uint16_t>(sign);
+
+		mantissa |= 0x800000u;
+
+		const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+		uint32_t half = mantissa >> shift;
+
+		const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+		const uint32_t halfway = 1u << (shift - 1u);
+
+		if (remainder > halfway || (remainder == halfway && (half & 1u)))
+			++half;
+
+		return static_cast<uint16_t>(sign | half);
+	}
+
+	uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+
+	// Round to nearest even (a carry correctly increments the exponent).
+	const uint32_t remainder = mantissa & 0x1FFFu;
+
+	if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)))
+		++half;
+
+	return static_cast<uint16_t>(sign | half);
+}
+
+Float2 EncodeOctahedral(const Float3& _vector)
+{
+	const float l1Norm = std::fabs(_vector.x) + std::fabs(_vector.y) + std::fabs(_vector.z);
+
+	if (l1Norm <= 0.0f)
+		return Float2{ 0.0f, 0.0f };
+
+	Float2 octahedral{ _vector.x / l1Norm, _vector.y / l1Norm };
+
+	// Lower hemisphere: fold over the diagonals.
+	if (_vector.z < 0.0f)
+	{
+		octahedral = Float2{
+			(1.0f - std::fabs(octahedral.y)) * SignNotZero(octahedral.x),
+			(1.0f - std::fabs(octahedral.x)) * SignNotZero(octahedral.y),
+		};
+	}
+
+	return octahedral;
+}
+
+Float3 DecodeOctahedral(const Float2& _octahedral)
+{
+	Float3 vector{ _octahedral.x, _octahedral.y, 1.0f - std::fabs(_octahedral.x) - std::fabs(_octahedral.y) };
+
+	const float t = std::clamp(-vector.z, 0.0f, 1.0f);
+
+	vector.x += vector.x >= 0.0f ? -t : t;
+	vector.y += vector.y >= 0.0f ? -t : t;
+
+	const float length = std::sqrt(vector.x * vector.x + vector.y * vector.y + vector.z * vector.z);
+
+	return Float3{ vector.x / length, vector.y / length, vector.z / length };
+}
+
+PositionDequantization ComputePositionDequantization(const MeshBounds& _bounds)
+{
+	return PositionDequantization{
+		.scale = Float3{ _bounds.max.x - _bounds.min.x, _bounds.max.y - _bounds.min.y, _bounds.max.z - _bounds.min.z },
+		.offset = _bounds.min,
+	};
+}
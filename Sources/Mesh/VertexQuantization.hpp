@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Compressed vertex attribute encodings (decoded by the input assembler + LitShader.hlsl with QUANTIZED_VERTEX).
+*   - Position: 16-bit UNORM, relative to mesh bounds (dequantized with ObjectUBO scale/offset).
+*     w stores the tangent handedness (the octahedral tangent only keeps its direction).
+*   - Normal / Tangent: octahedral encoding, 16-bit SNORM (2 components for a unit vector).
+*   - UV: half float.
+*/
+
+/// float -> 16-bit UNORM (DXGI rules: round to nearest).
+uint16_t QuantizeUNorm16(float _value);
+
+/// float -> 16-bit SNORM (DXGI rules: round to nearest, -32768 is never produced).
+int16_t QuantizeSNorm16(float _value);
+
+/// float -> IEEE 754 half float (round to nearest even).
+uint16_t FloatToHalf(float _value);
+
+/// Unit vector -> octahedral coordinates in [-1, 1]^2.
+Float2 EncodeOctahedral(const Float3& _vector);
+
+/// Octahedral coordinates -> unit vector (same as LitShader.hlsl DecodeOctahedral).
+Float3 DecodeOctahedral(const Float2& _octahedral);
+
+
+/**
+* Position dequantization: position = quantized * scale + offset.
+* Degenerate axes (flat meshes) get a null scale.
+*/
+struct PositionDequantization
+{
+	Float3 scale;
+	Float3 offset;
+};
+
+PositionDequantization ComputePositionDequantization(const MeshBounds& _bounds);
@@ -0,0 +1,282 @@
+#include "Mesh/VertexWelder.hpp"
+
+#include "Core/CPUFeatures.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+	constexpr uint32_t invalidIndex = ~0u;
+
+//{ Attributes compare
+
+	/**
+	* Attributes of one vertex packed in 3 SSE registers: position (3), normal (3), uv (2), tangent (4).
+	* Epsilons use the same layout.
+	*/
+	struct alignas(16) PackedVertex
+	{
+		float values[12];
+	};
+
+	PackedVertex PackVertex(const MeshData& _mesh, uint32_t _index, bool _bTangents)
+	{
+		const Float3& position = _mesh.positions[_index];
+		const Float3& normal = _mesh.normals[_index];
+		const Float2& uv = _mesh.uvs[_index];
+		const Float4 tangent = _bTangents ? _mesh.tangents[_index] : Float4{};
+
+		return PackedVertex{ {
+			position.x, position.y, position.z,
+			normal.x, normal.y, normal.z,
+			uv.x, uv.y,
+			tangent.x, tangent.y, tangent.z, tangent.w,
+		} };
+	}
+
+	/// |_lhs - _rhs| <= _epsilons on every attribute component.
+	bool IsWithinTolerance(const PackedVertex& _lhs, const PackedVertex& _rhs, const PackedVertex& _epsilons)
+	{
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+		__m128 match = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+		for (uint32_t i = 0; i < 12; i += 4)
+		{
+			const __m128 diff = _mm_and_ps(_mm_sub_ps(_mm_load_ps(_lhs.values + i), _mm_load_ps(_rhs.values + i)), absMask);
+			match = _mm_and_ps(match, _mm_cmple_ps(diff, _mm_load_ps(_epsilons.values + i)));
+		}
+
+		return _mm_movemask_ps(match) == 0xF;
+	}
+
+//}
+
+
+//{ Position grid
+
+	/**
+	* Hash grid of unique vertices: open addressing on cell coordinates, vertices of a cell in a linked list.
+	*/
+	class PositionGrid
+	{
+	public:
+		PositionGrid(uint32_t _vertexNum)
+		{
+			uint32_t tableSize = 64u;
+
+			while (tableSize < _vertexNum * 2u)
+				tableSize *= 2u;
+
+			mCells.resize(tableSize);
+			mNext.resize(_vertexNum, invalidIndex);
+		}
+
+		/// First vertex of the cell (then follow GetNext()), invalidIndex if empty.
+		uint32_t GetHead(int32_t _x, int32_t _y, int32_t _z) const
+		{
+			return mCells[FindSlot(_x, _y, _z)].head;
+		}
+
+		uint32_t GetNext(uint32_t _vertex) const
+		{
+			return mNext[_vertex];
+		}
+
+		void Insert(int32_t _x, int32_t _y, int32_t _z, uint32_t _vertex)
+		{
+			Cell& cell = mCells[FindSlot(_x, _y, _z)];
+
+			cell.x = _x;
+			cell.y = _y;
+			cell.z = _z;
+
+			mNext[_vertex] = cell.head;
+			cell.head = _vertex;
+		}
+
+	private:
+		struct Cell
+		{
+			int32_t x = 0;
+			int32_t y = 0;
+			int32_t z = 0;
+
+			uint32_t head = invalidIndex;
+		};
+
+		std::vector<Cell> mCells;
+		std::vector<uint32_t> mNext;
+
+		uint32_t FindSlot(int32_t _x, int32_t _y, int32_t _z) const
+		{
+			const uint32_t mask = static_cast<uint32_t>(mCells.size()) - 1u;
+
+			uint32_t slot = ((static_cast<uint32_t>(_x) * 73856093u) ^ (static_cast<uint32_t>(_y) * 19349663u) ^ (static_cast<uint32_t>(_z) * 83492791u)) & mask;
+
+			while (mCells[slot].head != invalidIndex && (mCells[slot].x != _x || mCells[slot].y != _y || mCells[slot].z != _z))
+				slot = (slot + 1u) & mask;
+
+			return slot;
+		}
+	};
+
+//}
+
+
+	/// Weld a single mesh (0-based indices).
+	WeldStats WeldMesh(MeshData& _mesh, const WeldSettings& _settings)
+	{
+		const uint32_t vertexNum = static_cast<uint32_t>(_mesh.positions.size());
+		const bool bTangents = _mesh.tangents.size() == vertexNum;
+
+		WeldStats stats{ .vertexNumBefore = vertexNum };
+
+		const MeshBounds bounds = ComputeBounds(_mesh.positions.data(), vertexNum);
+		const float extent = (std::max)({ bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z });
+
+		// Cell coordinates stay in int32 range.
+		const float positionEpsilon = (std::max)(_settings.positionEpsilon, 1e-9f) * extent;
+		const double invCellSize = positionEpsilon > 0.0f ? 1.0 / (2.0 * positionEpsilon) : 1.0;
+
+		const PackedVertex epsilons{ {
+			positionEpsilon, positionEpsilon, positionEpsilon,
+			_settings.normalEpsilon, _settings.normalEpsilon, _settings.normalEpsilon,
+			_settings.uvEpsilon, _settings.uvEpsilon,
+			_settings.tangentEpsilon, _settings.tangentEpsilon, _settings.tangentEpsilon, _settings.tangentEpsilon,
+		} };
+
+		// Representative (first matching unique vertex) of each vertex.
+		std::vector<uint32_t> representatives(vertexNum);
+		std::vector<PackedVertex> packedVertices(vertexNum);
+
+		PositionGrid grid(vertexNum);
+
+		for (uint32_t v = 0; v < vertexNum; ++v)
+		{
+			packedVertices[v] = PackVertex(_mesh, v, bTangents);
+
+			const Float3& position = _mesh.positions[v];
+
+			const double coords[3]{
+				(position.x - bounds.min.x) * invCellSize,
+				(position.y - bounds.min.y) * invCellSize,
+				(position.z - bounds.min.z) * invCellSize,
+			};
+
+			int32_t cell[3];
+			int32_t neighbor[3];
+
+			// Vertices within epsilon are in this cell or in the neighbor on the closest side (cell size: 2 * epsilon).
+			for (uint32_t i = 0; i < 3; ++i)
+			{
+				const double floored = std::floor(coords[i]);
+
+				cell[i] = static_cast<int32_t>(floored);
+				neighbor[i] = coords[i] - floored >= 0.5 ? cell[i] + 1 : cell[i] - 1;
+			}
+
+			uint32_t representative = invalidIndex;
+
+			for (uint32_t n = 0; n < 8u && representative == invalidIndex; ++n)
+			{
+				const int32_t x = (n & 1u) ? neighbor[0] : cell[0];
+				const int32_t y = (n & 2u) ? neighbor[1] : cell[1];
+				const int32_t z = (n & 4u) ? neighbor[2] : cell[2];
+
+				for (uint32_t candidate = grid.GetHead(x, y, z); candidate != invalidIndex; candidate = grid.GetNext(candidate))
+				{
+					if (IsWithinTolerance(packedVertices[v], packedVertices[candidate], epsilons))
+					{
+						representative = candidate;
+						break;
+					}
+				}
+			}
+
+			if (representative == invalidIndex)
+			{
+				representative = v;
+				grid.Insert(cell[0], cell[1], cell[2], v);
+			}
+
+			representatives[v] = representative;
+		}
+
+		// Remap triangles, drop collapsed ones.
+		std::vector<uint32_t> indices;
+		indices.reserve(_mesh.indices.size());
+
+		for (size_t i = 0; i + 2 < _mesh.indices.size(); i += 3)
+		{
+			const uint32_t i0 = representatives[_mesh.indices[i]];
+			const uint32_t i1 = representatives[_mesh.indices[i + 1]];
+			const uint32_t i2 = representatives[_mesh.indices[i + 2]];
+
+			if (i0 == i1 || i1 == i2 || i2 == i0)
+			{
+				++stats.degenerateTriangleNum;
+				continue;
+			}
+
+			indices.insert(indices.end(), { i0, i1, i2 });
+		}
+
+		// Compact referenced unique vertices, in first use order.
+		MeshData welded;
+		std::vector<uint32_t> remap(vertexNum, invalidIndex);
+
+		for (uint32_t& index : indices)
+		{
+			if (remap[index] == invalidIndex)
+			{
+				remap[index] = static_cast<uint32_t>(welded.positions.size());
+
+				welded.positions.push_back(_mesh.positions[index]);
+				welded.normals.push_back(_mesh.normals[index]);
+				welded.uvs.push_back(_mesh.uvs[index]);
+
+				if (bTangents)
+					welded.tangents.push_back(_mesh.tangents[index]);
+			}
+
+			index = remap[index];
+		}
+
+		welded.indices = std::move(indices);
+		welded.bounds = _mesh.bounds;
+		welded.sphere = _mesh.sphere;
+
+		stats.vertexNumAfter = static_cast<uint32_t>(welded.positions.size());
+
+		_mesh = std::move(welded);
+
+		return stats;
+	}
+}
+
+
+std::vector<WeldStats> WeldVertices(MeshData& _mesh, const WeldSettings& _settings)
+{
+	std::vector<WeldStats> stats;
+	stats.reserve(_mesh.submeshes.size());
+
+	MeshData result;
+
+	for (const Submesh& submesh : _mesh.submeshes)
+	{
+		MeshData submeshData = ExtractSubmesh(_mesh, submesh);
+
+		stats.push_back(WeldMesh(submeshData, _settings));
+
+		AppendSubmesh(result, submeshData);
+	}
+
+	result.bounds = _mesh.bounds;
+	result.sphere = _mesh.sphere;
+
+	_mesh = std::move(result);
+
+	return stats;
+}
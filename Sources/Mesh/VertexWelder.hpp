@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Mesh/MeshData.hpp"
+
+/**
+* Vertex welding (deduplication), run at cook time right after import (see MeshCooker).
+* Importers without aiProcess_JoinIdenticalVertices keep one vertex per face corner:
+* welding shrinks the vertex buffers and lets triangles share transformed vertices (post-transform cache).
+*
+* Vertices are hashed in a position grid (cell size: 2 * position epsilon), so candidates within epsilon
+* are found in 8 cells. Candidates are compared on every attribute at once (SSE2, 4 floats per compare).
+* A vertex is merged into the first unique vertex matching all tolerances (no chaining: unique vertices never drift).
+*/
+
+struct WeldSettings
+{
+	/// Max position difference per axis, relative to the submesh bounds extent.
+	float positionEpsilon = 1e-6f;
+
+	/// Max difference per component of normals and tangents (unit vectors).
+	float normalEpsilon = 1e-3f;
+	float tangentEpsilon = 1e-3f;
+
+	/// Max difference per UV component.
+	float uvEpsilon = 1e-5f;
+};
+
+struct WeldStats
+{
+	uint32_t vertexNumBefore = 0u;
+	uint32_t vertexNumAfter = 0u;
+
+	/// Triangles collapsed by welding (2 or 3 corners merged), removed from the index buffer.
+	uint32_t degenerateTriangleNum = 0u;
+};
+
+/**
+* Weld the vertices of every submesh and remap their indices.
+* Run before OptimizeMesh() / BuildMeshLODs(): the mesh is rebuilt submesh by submesh (LODs and meshlets are not kept).
+* Tangents are compared when present (welding usually runs before GenerateTangents).
+* Return the stats of each submesh.
+*/
+std::vector<WeldStats> WeldVertices(MeshData& _mesh, const WeldSettings& _settings = WeldSettings{});
@@ -0,0 +1,764 @@
+#include "Texture/BCEncoder.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+#include "Core/ParallelFor.hpp"
+
+namespace
+{
+	// Rows of blocks encoded per task.
+	constexpr uint32_t blockRowsPerTask = 2u;
+
+	// Least-squares refinement iterations (High quality).
+	constexpr uint32_t refineIterationNum = 2u;
+
+
+	// 4x4 source texels, always expanded to RGBA.
+	struct Block
+	{
+		float texels[16][4];
+	};
+
+	void LoadBlock(const ImageView& _src, uint32_t _channelNum, uint32_t _blockX, uint32_t _blockY, Block& _block)
+	{
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			// Replicate the last row/column for partial edge blocks.
+			const uint32_t srcY = (std::min)(_blockY * 4 + y, _src.height - 1);
+			const uint8_t* const row = _src.data + srcY * _src.rowPitch;
+
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				const uint32_t srcX = (std::min)(_blockX * 4 + x, _src.width - 1);
+				float* const texel = _block.texels[y * 4 + x];
+
+				if (_channelNum == 4)
+				{
+					for (uint32_t c = 0; c < 4; ++c)
+						texel[c] = row[srcX * 4 + c];
+				}
+				else
+				{
+					texel[0] = row[srcX];
+					texel[1] = texel[2] = 0.0f;
+					texel[3] = 255.0f;
+				}
+			}
+		}
+	}
+
+
+//{ Endpoints helpers
+
+	/**
+	* Principal axis endpoints: project the texels on the main axis of the covariance matrix (power iteration).
+	*/
+	void ComputePCAEndpoints(const Block& _block, uint32_t _channelNum, float _outE0[4], float _outE1[4])
+	{
+		float mean[4] = {};
+
+		for (const float* texel : _block.texels)
+		{
+			for (uint32_t c = 0; c < _channelNum; ++c)
+				mean[c] += texel[c] / 16.0f;
+		}
+
+		float cov[4][4] = {};
+
+		for (const float* texel : _block.texels)
+		{
+			for (uint32_t i = 0; i < _channelNum; ++i)
+			{
+				for (uint32_t j = 0; j < _channelNum; ++j)
+					cov[i][j] += (texel[i] - mean[i]) * (texel[j] - mean[j]);
+			}
+		}
+
+		float axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+		for (uint32_t it = 0; it < 8; ++it)
+		{
+			float next[4] = {};
+			float maxAbs = 0.0f;
+
+			for (uint32_t i = 0; i < _channelNum; ++i)
+			{
+				for (uint32_t j = 0; j < _channelNum; ++j)
+					next[i] += cov[i][j] * axis[j];
+
+				maxAbs = (std::max)(maxAbs, std::fabs(next[i]));
+			}
+
+			// Solid block: no principal axis.
+			if (maxAbs < 1e-6f)
+				break;
+
+			for (uint32_t i = 0; i < _channelNum; ++i)
+				axis[i] = next[i] / maxAbs;
+		}
+
+		float axisLengthSqr = 0.0f;
+		for (uint32_t c = 0; c < _channelNum; ++c)
+			axisLengthSqr += axis[c] * axis[c];
+
+		float minT = 0.0f;
+		float maxT = 0.0f;
+
+		for (const float* texel : _block.texels)
+		{
+			float t = 0.0f;
+
+			for (uint32_t c = 0; c < _channelNum; ++c)
+				t += (texel[c] - mean[c]) * axis[c];
+
+			t /= axisLengthSqr;
+
+			minT = (std::min)(minT, t);
+			maxT = (std::max)(maxT, t);
+		}
+
+		for (uint32_t c = 0; c < _channelNum; ++c)
+		{
+			_outE0[c] = std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+			_outE1[c] = std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+		}
+	}
+
+	void ComputeBoundingBoxEndpoints(const Block& _block, uint32_t _channelNum, float _outE0[4], float _outE1[4])
+	{
+		for (uint32_t c = 0; c < _channelNum; ++c)
+		{
+			_outE0[c] = 255.0f;
+			_outE1[c] = 0.0f;
+		}
+
+		for (const float* texel : _block.texels)
+		{
+			for (uint32_t c = 0; c < _channelNum; ++c)
+			{
+				_outE0[c] = (std::min)(_outE0[c], texel[c]);
+				_outE1[c] = (std::max)(_outE1[c], texel[c]);
+			}
+		}
+	}
+
+	/**
+	* Least-squares endpoints for fixed interpolation weights: minimize sum(|(1 - w) * e0 + w * e1 - texel|^2).
+	* Return false if the system is degenerate (all texels use the same weight).
+	*/
+	bool SolveLeastSquaresEndpoints(const Block& _block, const float _weights[16], uint32_t _channelNum, float _outE0[4], float _outE1[4])
+	{
+		float a = 0.0f;
+		float b = 0.0f;
+		float d = 0.0f;
+		float x0[4] = {};
+		float x1[4] = {};
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			const float w = _weights[i];
+
+			a += (1.0f - w) * (1.0f - w);
+			b += (1.0f - w) * w;
+			d += w * w;
+
+			for (uint32_t c = 0; c < _channelNum; ++c)
+			{
+				x0[c] += (1.0f - w) * _block.texels[i][c];
+				x1[c] += w * _block.texels[i][c];
+			}
+		}
+
+		const float det = a * d - b * b;
+		if (std::fabs(det) < 1e-6f)
+			return false;
+
+		for (uint32_t c = 0; c < _channelNum; ++c)
+		{
+			_outE0[c] = std::clamp((d * x0[c] - b * x1[c]) / det, 0.0f, 255.0f);
+			_outE1[c] = std::clamp((a * x1[c] - b * x0[c]) / det, 0.0f, 255.0f);
+		}
+
+		return true;
+	}
+
+//}
+
+
+//{ BC1
+
+	uint16_t QuantizeRGB565(const float _rgb[3])
+	{
+		const uint32_t r = static_cast<uint32_t>(_rgb[0] * (31.0f / 255.0f) + 0.5f);
+		const uint32_t g = static_cast<uint32_t>(_rgb[1] * (63.0f / 255.0f) + 0.5f);
+		const uint32_t b = static_cast<uint32_t>(_rgb[2] * (31.0f / 255.0f) + 0.5f);
+
+		return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	void UnpackRGB565(uint16_t _color, int32_t _outRGB[3])
+	{
+		const int32_t r = (_color >> 11) & 31;
+		const int32_t g = (_color >> 5) & 63;
+		const int32_t b = _color & 31;
+
+		// Bit replication, as the hardware decoder.
+		_outRGB[0] = (r << 3) | (r >> 2);
+		_outRGB[1] = (g << 2) | (g >> 4);
+		_outRGB[2] = (b << 3) | (b >> 2);
+	}
+
+	struct BC1Block
+	{
+		uint16_t color0 = 0u;
+		uint16_t color1 = 0u;
+		uint32_t indices = 0u;
+
+		float error = 0.0f;
+	};
+
+	// Interpolation weight of e1 for each index (4-color mode).
+	constexpr float bc1Weights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+	BC1Block EvaluateBC1(const Block& _block, const float _e0[4], const float _e1[4])
+	{
+		BC1Block out;
+		out.color0 = QuantizeRGB565(_e0);
+		out.color1 = QuantizeRGB565(_e1);
+
+		// 4-color mode requires color0 > color1.
+		if (out.color0 < out.color1)
+			std::swap(out.color0, out.color1);
+
+		int32_t palette[4][3];
+		UnpackRGB565(out.color0, palette[0]);
+		UnpackRGB565(out.color1, palette[1]);
+
+		for (uint32_t c = 0; c < 3; ++c)
+		{
+			palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+			palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+		}
+
+		// Equal endpoints is 3-color mode: only index 0 is valid (same color).
+		const uint32_t paletteNum = out.color0 == out.color1 ? 1u : 4u;
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			float bestError = 1e30f;
+			uint32_t bestIndex = 0u;
+
+			for (uint32_t p = 0; p < paletteNum; ++p)
+			{
+				float error = 0.0f;
+
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					const float diff = _block.texels[i][c] - palette[p][c];
+					error += diff * diff;
+				}
+
+				if (error < bestError)
+				{
+					bestError = error;
+					bestIndex = p;
+				}
+			}
+
+			out.indices |= bestIndex << (2 * i);
+			out.error += bestError;
+		}
+
+		return out;
+	}
+
+	void EncodeBC1Block(const Block& _block, BCQuality _quality, uint8_t* _dst)
+	{
+		float e0[4];
+		float e1[4];
+
+		if (_quality == BCQuality::Fast)
+			ComputeBoundingBoxEndpoints(_block, 3, e0, e1);
+		else
+			ComputePCAEndpoints(_block, 3, e0, e1);
+
+		BC1Block best = EvaluateBC1(_block, e0, e1);
+
+		if (_quality == BCQuality::High)
+		{
+			for (uint32_t it = 0; it < refineIterationNum; ++it)
+			{
+				float weights[16];
+				for (uint32_t i = 0; i < 16; ++i)
+				{
+					// Palette order: color0 is the e0 of the quantized (possibly swapped) block.
+					weights[i] = bc1Weights[(best.indices >> (2 * i)) & 3];
+				}
+
+				float refined0[4];
+				float refined1[4];
+				if (!SolveLeastSquaresEndpoints(_block, weights, 3, refined0, refined1))
+					break;
+
+				const BC1Block candidate = EvaluateBC1(_block, refined0, refined1);
+				if (candidate.error >= best.error)
+					break;
+
+				best = candidate;
+			}
+		}
+
+		_dst[0] = static_cast<uint8_t>(best.color0);
+		_dst[1] = static_cast<uint8_t>(best.color0 >> 8);
+		_dst[2] = static_cast<uint8_t>(best.color1);
+		_dst[3] = static_cast<uint8_t>(best.color1 >> 8);
+
+		for (uint32_t i = 0; i < 4; ++i)
+			_dst[4 + i] = static_cast<uint8_t>(best.indices >> (8 * i));
+	}
+
+//}
+
+
+//{ BC4
+
+	struct BC4Block
+	{
+		uint8_t red0 = 0u;
+		uint8_t red1 = 0u;
+		uint64_t indices = 0u;
+
+		uint32_t error = 0u;
+	};
+
+	BC4Block EvaluateBC4(const uint8_t _values[16], uint8_t _red0, uint8_t _red1)
+	{
+		BC4Block out;
+		out.red0 = _red0;
+		out.red1 = _red1;
+
+		int32_t palette[8];
+		palette[0] = _red0;
+		palette[1] = _red1;
+
+		if (_red0 > _red1)
+		{
+			// 8-value mode.
+			for (int32_t i = 2; i < 8; ++i)
+				palette[i] = ((8 - i) * _red0 + (i - 1) * _red1) / 7;
+		}
+		else
+		{
+			// 6-value mode + explicit 0 and 255.
+			for (int32_t i = 2; i < 6; ++i)
+				palette[i] = ((6 - i) * _red0 + (i - 1) * _red1) / 5;
+
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			uint32_t bestError = ~0u;
+			uint32_t bestIndex = 0u;
+
+			for (uint32_t p = 0; p < 8; ++p)
+			{
+				const int32_t diff = _values[i] - palette[p];
+				const uint32_t error = static_cast<uint32_t>(diff * diff);
+
+				if (error < bestError)
+				{
+					bestError = error;
+					bestIndex = p;
+				}
+			}
+
+			out.indices |= static_cast<uint64_t>(bestIndex) << (3 * i);
+			out.error += bestError;
+		}
+
+		return out;
+	}
+
+	void EncodeBC4Block(const uint8_t _values[16], BCQuality _quality, uint8_t* _dst)
+	{
+		uint8_t minValue = 255u;
+		uint8_t maxValue = 0u;
+
+		// Range excluding 0 and 255 (explicit values of the 6-value mode).
+		uint8_t minInner = 255u;
+		uint8_t maxInner = 0u;
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			minValue = (std::min)(minValue, _values[i]);
+			maxValue = (std::max)(maxValue, _values[i]);
+
+			if (_values[i] != 0u && _values[i] != 255u)
+			{
+				minInner = (std::min)(minInner, _values[i]);
+				maxInner = (std::max)(maxInner, _values[i]);
+			}
+		}
+
+		BC4Block best = EvaluateBC4(_values, maxValue, minValue);
+
+		if (_quality != BCQuality::Fast && best.error > 0u)
+		{
+			// 6-value mode: better when the block contains extreme values.
+			if (minInner <= maxInner)
+			{
+				const BC4Block candidate = EvaluateBC4(_values, minInner, maxInner);
+				if (candidate.error < best.error)
+					best = candidate;
+			}
+		}
+
+		if (_quality == BCQuality::High && best.error > 0u)
+		{
+			// Inset search: endpoints on extreme values are rarely optimal for 8 levels.
+			const int32_t range = maxValue - minValue;
+			const int32_t maxInset = (std::min)(range / 8 + 1, 8);
+
+			for (int32_t inset0 = 0; inset0 <= maxInset; ++inset0)
+			{
+				for (int32_t inset1 = 0; inset1 <= maxInset; ++inset1)
+				{
+					const int32_t red0 = maxValue - inset0;
+					const int32_t red1 = minValue + inset1;
+
+					if (red0 <= red1)
+						continue;
+
+					const BC4Block candidate = EvaluateBC4(_values, static_cast<uint8_t>(red0), static_cast<uint8_t>(red1));
+					if (candidate.error < best.error)
+						best = candidate;
+				}
+			}
+		}
+
+		_dst[0] = best.red0;
+		_dst[1] = best.red1;
+
+		for (uint32_t i = 0; i < 6; ++i)
+			_dst[2 + i] = static_cast<uint8_t>(best.indices >> (8 * i));
+	}
+
+	void EncodeBC4Block(const Block& _block, uint32_t _channel, BCQuality _quality, uint8_t* _dst)
+	{
+		uint8_t values[16];
+
+		for (uint32_t i = 0; i < 16; ++i)
+			values[i] = static_cast<uint8_t>(_block.texels[i][_channel]);
+
+		EncodeBC4Block(values, _quality, _dst);
+	}
+
+//}
+
+
+//{ BC7 (mode 6)
+
+	constexpr uint32_t bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	struct BC7Mode6Block
+	{
+		// 7-bit endpoint values and p-bits.
+		uint8_t endpoints[2][4] = {};
+		uint8_t pbits[2] = {};
+
+		uint8_t indices[16] = {};
+
+		float error = 0.0f;
+	};
+
+	// Quantize _endpoint to 7 bits + p-bit (per endpoint, shared by all channels).
+	void QuantizeBC7Endpoint(const float _endpoint[4], uint32_t _pbit, uint8_t _out[4])
+	{
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			const float q = std::round((_endpoint[c] - static_cast<float>(_pbit)) / 2.0f);
+			_out[c] = static_cast<uint8_t>(std::clamp(q, 0.0f, 127.0f));
+		}
+	}
+
+	float ComputeBC7QuantizationError(const float _endpoint[4], uint32_t _pbit)
+	{
+		uint8_t quantized[4];
+		QuantizeBC7Endpoint(_endpoint, _pbit, quantized);
+
+		float error = 0.0f;
+
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			const float diff = static_cast<float>((quantized[c] << 1) | _pbit) - _endpoint[c];
+			error += diff * diff;
+		}
+
+		return error;
+	}
+
+	BC7Mode6Block EvaluateBC7Mode6(const Block& _block, const float _e0[4], const float _e1[4], uint32_t _pbit0, uint32_t _pbit1)
+	{
+		BC7Mode6Block out;
+		out.pbits[0] = static_cast<uint8_t>(_pbit0);
+		out.pbits[1] = static_cast<uint8_t>(_pbit1);
+
+		QuantizeBC7Endpoint(_e0, _pbit0, out.endpoints[0]);
+		QuantizeBC7Endpoint(_e1, _pbit1, out.endpoints[1]);
+
+		int32_t decoded[2][4];
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			decoded[0][c] = (out.endpoints[0][c] << 1) | _pbit0;
+			decoded[1][c] = (out.endpoints[1][c] << 1) | _pbit1;
+		}
+
+		int32_t palette[16][4];
+		for (uint32_t p = 0; p < 16; ++p)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+				palette[p][c] = ((64 - bc7Weights4[p]) * decoded[0][c] + bc7Weights4[p] * decoded[1][c] + 32) >> 6;
+		}
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			float bestError = 1e30f;
+			uint32_t bestIndex = 0u;
+
+			for (uint32_t p = 0; p < 16; ++p)
+			{
+				float error = 0.0f;
+
+				for (uint32_t c = 0; c < 4; ++c)
+				{
+					const float diff = _block.texels[i][c] - palette[p][c];
+					error += diff * diff;
+				}
+
+				if (error < bestError)
+				{
+					bestError = error;
+					bestIndex = p;
+				}
+			}
+
+			out.indices[i] = static_cast<uint8_t>(bestIndex);
+			out.error += bestError;
+		}
+
+		return out;
+	}
+
+	BC7Mode6Block EvaluateBC7Mode6BestPBits(const Block& _block, const float _e0[4], const float _e1[4], bool _bSearchAll)
+	{
+		if (_bSearchAll)
+		{
+			BC7Mode6Block best;
+			best.error = 1e30f;
+
+			for (uint32_t pbits = 0; pbits < 4; ++pbits)
+			{
+				const BC7Mode6Block candidate = EvaluateBC7Mode6(_block, _e0, _e1, pbits & 1, pbits >> 1);
+				if (candidate.error < best.error)
+					best = candidate;
+			}
+
+			return best;
+		}
+
+		// Pick each p-bit from its endpoint quantization error only.
+		const uint32_t pbit0 = ComputeBC7QuantizationError(_e0, 1) < ComputeBC7QuantizationError(_e0, 0) ? 1u : 0u;
+		const uint32_t pbit1 = ComputeBC7QuantizationError(_e1, 1) < ComputeBC7QuantizationError(_e1, 0) ? 1u : 0u;
+
+		return EvaluateBC7Mode6(_block, _e0, _e1, pbit0, pbit1);
+	}
+
+	// Write _bitNum bits of _value at _bitOffset (LSB first) in a 128-bit block.
+	void WriteBits(uint8_t* _dst, uint32_t& _bitOffset, uint32_t _value, uint32_t _bitNum)
+	{
+		for (uint32_t i = 0; i < _bitNum; ++i, ++_bitOffset)
+		{
+			if ((_value >> i) & 1u)
+				_dst[_bitOffset >> 3] |= static_cast<uint8_t>(1u << (_bitOffset & 7));
+		}
+	}
+
+	void EncodeBC7Block(const Block& _block, BCQuality _quality, uint8_t* _dst)
+	{
+		float e0[4];
+		float e1[4];
+
+		if (_quality == BCQuality::Fast)
+			ComputeBoundingBoxEndpoints(_block, 4, e0, e1);
+		else
+			ComputePCAEndpoints(_block, 4, e0, e1);
+
+		const bool bHigh = _quality == BCQuality::High;
+
+		BC7Mode6Block best = EvaluateBC7Mode6BestPBits(_block, e0, e1, bHigh);
+
+		if (bHigh)
+		{
+			for (uint32_t it = 0; it < refineIterationNum; ++it)
+			{
+				float weights[16];
+				for (uint32_t i = 0; i < 16; ++i)
+					weights[i] = bc7Weights4[best.indices[i]] / 64.0f;
+
+				float refined0[4];
+				float refined1[4];
+				if (!SolveLeastSquaresEndpoints(_block, weights, 4, refined0, refined1))
+					break;
+
+				const BC7Mode6Block candidate = EvaluateBC7Mode6BestPBits(_block, refined0, refined1, true);
+				if (candidate.error >= best.error)
+					break;
+
+				best = candidate;
+			}
+		}
+
+		// Anchor index (texel 0) is stored without its MSB: must be < 8, swap endpoints otherwise.
+		if (best.indices[0] & 8u)
+		{
+			for (uint32_t c = 0; c < 4; ++c)
+				std::swap(best.endpoints[0][c], best.endpoints[1][c]);
+
+			std::swap(best.pbits[0], best.pbits[1]);
+
+			for (uint8_t& index : best.indices)
+				index = static_cast<uint8_t>(15u - index);
+		}
+
+		std::fill(_dst, _dst + 16, uint8_t(0u));
+
+		uint32_t bitOffset = 0u;
+
+		// Mode 6: 6 zero bits then 1.
+		WriteBits(_dst, bitOffset, 1u << 6, 7);
+
+		// Endpoints: R0 R1 G0 G1 B0 B1 A0 A1.
+		for (uint32_t c = 0; c < 4; ++c)
+		{
+			WriteBits(_dst, bitOffset, best.endpoints[0][c], 7);
+			WriteBits(_dst, bitOffset, best.endpoints[1][c], 7);
+		}
+
+		WriteBits(_dst, bitOffset, best.pbits[0], 1);
+		WriteBits(_dst, bitOffset, best.pbits[1], 1);
+
+		WriteBits(_dst, bitOffset, best.indices[0], 3);
+
+		for (uint32_t i = 1; i < 16; ++i)
+			WriteBits(_dst, bitOffset, best.indices[i], 4);
+	}
+
+//}
+}
+
+
+uint32_t GetBCBlockSize(BCFormat _format)
+{
+	return _format == BCFormat::BC1 || _format == BCFormat::BC4 ? 8u : 16u;
+}
+
+void EncodeBC(const ImageView& _src, ImageFormat _srcFormat, const BCLevel& _dst, BCFormat _format, BCQuality _quality)
+{
+	const uint32_t channelNum = GetImageFormatChannelNum(_srcFormat);
+	const uint32_t blockSize = GetBCBlockSize(_format);
+	const uint32_t blockNumX = (_src.width + 3) / 4;
+	const uint32_t blockNumY = (_src.height + 3) / 4;
+
+	const uint32_t taskNum = (blockNumY + blockRowsPerTask - 1) / blockRowsPerTask;
+
+	ParallelFor(taskNum, [&](uint32_t _task)
+	{
+		const uint32_t blockYEnd = (std::min)(blockNumY, (_task + 1) * blockRowsPerTask);
+
+		Block block;
+
+		for (uint32_t blockY = _task * blockRowsPerTask; blockY < blockYEnd; ++blockY)
+		{
+			uint8_t* const dstRow = _dst.data + blockY * _dst.rowPitch;
+
+			for (uint32_t blockX = 0; blockX < blockNumX; ++blockX)
+			{
+				LoadBlock(_src, channelNum, blockX, blockY, block);
+
+				uint8_t* const dstBlock = dstRow + blockX * blockSize;
+
+				switch (_format)
+				{
+					case BCFormat::BC1:
+						EncodeBC1Block(block, _quality, dstBlock);
+						break;
+					case BCFormat::BC3:
+						EncodeBC4Block(block, 3, _quality, dstBlock);
+						EncodeBC1Block(block, _quality, dstBlock + 8);
+						break;
+					case BCFormat::BC4:
+						EncodeBC4Block(block, 0, _quality, dstBlock);
+						break;
+					case BCFormat::BC5:
+						EncodeBC4Block(block, 0, _quality, dstBlock);
+						EncodeBC4Block(block, 1, _quality, dstBlock + 8);
+						break;
+					case BCFormat::BC7:
+						EncodeBC7Block(block, _quality, dstBlock);
+						break;
+				}
+			}
+		}
+	});
+}
+
+uint64_t ComputeBCLayout(uint32_t _width, uint32_t _height, uint32_t _levelNum, BCFormat _format, std::vector<BCLevel>& _outLevels)
+{
+	_outLevels.resize(_levelNum);
+
+	uint64_t totalSize = 0u;
+
+	for (uint32_t i = 0; i < _levelNum; ++i)
+	{
+		BCLevel& level = _outLevels[i];
+		level.width = ComputeMipSize(_width, i);
+		level.height = ComputeMipSize(_height, i);
+		level.rowPitch = static_cast<uint64_t>((level.width + 3) / 4) * GetBCBlockSize(_format);
+		level.rowNum = (level.height + 3) / 4;
+
+		totalSize += level.rowPitch * level.rowNum;
+	}
+
+	return totalSize;
+}
+
+void EncodeMipChainBC(const MipChain& _mips, const BCLevel* _dstLevels, BCFormat _format, BCQuality _quality)
+{
+	for (size_t i = 0; i < _mips.levels.size(); ++i)
+		EncodeBC(_mips.levels[i], _mips.format, _dstLevels[i], _format, _quality);
+}
+
+BCMipChain EncodeMipChainBC(const MipChain& _mips, BCFormat _format, BCQuality _quality)
+{
+	BCMipChain chain;
+	chain.format = _format;
+	chain.bSRGB = _mips.format == ImageFormat::RGBA8_SRGB;
+
+	const uint64_t totalSize = ComputeBCLayout(_mips.levels[0].width, _mips.levels[0].height, static_cast<uint32_t>(_mips.levels.size()), _format, chain.levels);
+	chain.data.resize(totalSize);
+
+	uint64_t offset = 0u;
+
+	for (BCLevel& level : chain.levels)
+	{
+		level.data = chain.data.data() + offset;
+		offset += level.rowPitch * level.rowNum;
+	}
+
+	EncodeMipChainBC(_mips, chain.levels.data(), _format, _quality);
+
+	return chain;
+}
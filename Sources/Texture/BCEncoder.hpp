@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Texture/MipGenerator.hpp"
+
+/**
+* CPU block-compression encoder (BCn / DXT).
+* Textures are split into 4x4 texel blocks, encoded in parallel (multithreaded across blocks).
+*
+*   - BC1: RGB, 8 bytes per block (4 bits per texel). 4-color mode only (no 1-bit alpha).
+*   - BC3: RGBA, 16 bytes per block (BC4 alpha block + BC1 color block).
+*   - BC4: R, 8 bytes per block. Single-channel maps (metallic, roughness...).
+*   - BC5: RG, 16 bytes per block (2 BC4 blocks). Normal maps: Z is rebuilt in shader.
+*   - BC7: RGBA, 16 bytes per block. Mode 6 only (single subset, 4-bit indices, RGBA 7.7.7.7 + p-bit endpoints).
+*
+* sRGB sources are encoded in gamma space (same data, *_SRGB format at view creation).
+*/
+
+enum class BCFormat : uint8_t
+{
+	BC1,
+	BC3,
+	BC4,
+	BC5,
+	BC7,
+};
+
+/**
+* Quality / speed knob.
+*   - Fast: bounding box endpoints.
+*   - Normal: principal axis (PCA) endpoints.
+*   - High: PCA endpoints + least-squares refinement iterations (and BC4 6-value mode / BC7 p-bit search).
+*/
+enum class BCQuality : uint8_t
+{
+	Fast,
+	Normal,
+	High,
+};
+
+
+/// Bytes per 4x4 block.
+uint32_t GetBCBlockSize(BCFormat _format);
+
+
+/**
+* One encoded mip level.
+* rowPitch is the size of a row of blocks, rowNum the number of rows of blocks.
+*/
+struct BCLevel
+{
+	uint8_t* data = nullptr;
+
+	// Size in texels.
+	uint32_t width = 0u;
+	uint32_t height = 0u;
+
+	uint64_t rowPitch = 0u;
+	uint32_t rowNum = 0u;
+};
+
+/**
+* Encode _src in _dst (_dst size must be at least rowPitch * rowNum).
+* Source channels: BC1/BC3/BC7 use RGBA, BC5 uses RG, BC4 uses R (R8 or RGBA source).
+* Partial edge blocks replicate the last texels.
+*/
+void EncodeBC(const ImageView& _src, ImageFormat _srcFormat, const BCLevel& _dst, BCFormat _format, BCQuality _quality);
+
+
+/**
+* Block-compressed mip chain owning its memory.
+*/
+struct BCMipChain
+{
+	BCFormat format = BCFormat::BC1;
+
+	// Encoded from sRGB data: use *_SRGB format.
+	bool bSRGB = false;
+
+	std::vector<uint8_t> data;
+
+	// Views into data, level 0 first.
+	std::vector<BCLevel> levels;
+};
+
+/**
+* Compute the levels size of a tightly packed BC mip chain (data pointers are left null).
+* Return the total size in bytes.
+*/
+uint64_t ComputeBCLayout(uint32_t _width, uint32_t _height, uint32_t _levelNum, BCFormat _format, std::vector<BCLevel>& _outLevels);
+
+BCMipChain EncodeMipChainBC(const MipChain& _mips, BCFormat _format, BCQuality _quality);
+
+/**
+* Encode every level of _mips into caller-provided levels (one per mip level, any rowPitch):
+* encode straight into staging memory with the copy footprint row pitch.
+*/
+void EncodeMipChainBC(const MipChain& _mips, const BCLevel* _dstLevels, BCFormat _format, BCQuality _quality);
@@ -0,0 +1,45 @@
+#include "Texture/ChannelPacker.hpp"
+
+#include <algorithm>
+
+#include "Core/ParallelFor.hpp"
+
+namespace
+{
+	// Rows processed per task.
+	constexpr uint32_t rowBlockSize = 64u;
+}
+
+void PackChannels(const ChannelSource* _sources, const ImageView& _dst)
+{
+	const uint32_t taskNum = (_dst.height + rowBlockSize - 1) / rowBlockSize;
+
+	ParallelFor(taskNum, [&](uint32_t _task)
+	{
+		const uint32_t yEnd = (std::min)(_dst.height, (_task + 1) * rowBlockSize);
+
+		for (uint32_t y = _task * rowBlockSize; y < yEnd; ++y)
+		{
+			uint8_t* const dstRow = _dst.data + y * _dst.rowPitch;
+
+			// One channel at a time: sequential source reads, constant source stride.
+			for (uint32_t c = 0; c < 4u; ++c)
+			{
+				const ChannelSource& source = _sources[c];
+
+				if (!source.data)
+				{
+					for (uint32_t x = 0; x < _dst.width; ++x)
+						dstRow[x * 4u + c] = source.constant;
+
+					continue;
+				}
+
+				const uint8_t* const srcRow = source.data + static_cast<uint64_t>(y) * _dst.width * source.channelNum + source.channel;
+
+				for (uint32_t x = 0; x < _dst.width; ++x)
+					dstRow[x * 4u + c] = srcRow[x * source.channelNum];
+			}
+		}
+	});
+}
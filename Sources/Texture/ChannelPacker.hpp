@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Texture/MipGenerator.hpp"
+
+/**
+* Channel packing: build one RGBA8 texture from channels of several images.
+* ie. ORM (glTF convention): R occlusion, G roughness, B metallic.
+* One texture, one descriptor and one sample per pixel instead of one per map.
+*/
+
+/// Source of one channel of a packed texture.
+struct ChannelSource
+{
+	/// Tightly packed source image, same size as the packed texture (nullptr: constant channel).
+	const uint8_t* data = nullptr;
+
+	/// Source texel size and channel read.
+	uint32_t channelNum = 1u;
+	uint32_t channel = 0u;
+
+	/// Channel value without source image.
+	uint8_t constant = 255u;
+};
+
+/**
+* Fill _dst (RGBA8) from 4 sources (R, G, B, A).
+* _dst can be any pitch (ie. a mip chain level 0).
+*/
+void PackChannels(const ChannelSource* _sources, const ImageView& _dst);
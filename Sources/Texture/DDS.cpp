@@ -0,0 +1,269 @@
+#include "Texture/DDS.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+	constexpr uint32_t MakeFourCC(char _c0, char _c1, char _c2, char _c3)
+	{
+		return static_cast<uint32_t>(_c0) | (static_cast<uint32_t>(_c1) << 8) | (static_cast<uint32_t>(_c2) << 16) | (static_cast<uint32_t>(_c3) << 24);
+	}
+
+	constexpr uint32_t ddsMagic = MakeFourCC('D', 'D', 'S', ' ');
+
+	// DXGI_FORMAT values (dxgiformat.h).
+	constexpr uint32_t dxgiFormatBC1Unorm = 71u;
+	constexpr uint32_t dxgiFormatBC1UnormSRGB = 72u;
+	constexpr uint32_t dxgiFormatBC3Unorm = 77u;
+	constexpr uint32_t dxgiFormatBC3UnormSRGB = 78u;
+	constexpr uint32_t dxgiFormatBC4Unorm = 80u;
+	constexpr uint32_t dxgiFormatBC5Unorm = 83u;
+	constexpr uint32_t dxgiFormatBC7Unorm = 98u;
+	constexpr uint32_t dxgiFormatBC7UnormSRGB = 99u;
+
+	// D3D10_RESOURCE_DIMENSION_TEXTURE2D.
+	constexpr uint32_t resourceDimensionTexture2D = 3u;
+
+	// DDS_HEADER flags.
+	constexpr uint32_t ddsdCaps = 0x1;
+	constexpr uint32_t ddsdHeight = 0x2;
+	constexpr uint32_t ddsdWidth = 0x4;
+	constexpr uint32_t ddsdPixelFormat = 0x1000;
+	constexpr uint32_t ddsdMipMapCount = 0x20000;
+	constexpr uint32_t ddsdLinearSize = 0x80000;
+
+	constexpr uint32_t ddpfFourCC = 0x4;
+
+	constexpr uint32_t ddsCapsComplex = 0x8;
+	constexpr uint32_t ddsCapsTexture = 0x1000;
+	constexpr uint32_t ddsCapsMipMap = 0x400000;
+
+	struct DDSPixelFormat
+	{
+		uint32_t size;
+		uint32_t flags;
+		uint32_t fourCC;
+		uint32_t rgbBitCount;
+		uint32_t rBitMask;
+		uint32_t gBitMask;
+		uint32_t bBitMask;
+		uint32_t aBitMask;
+	};
+
+	struct DDSHeader
+	{
+		uint32_t size;
+		uint32_t flags;
+		uint32_t height;
+		uint32_t width;
+		uint32_t pitchOrLinearSize;
+		uint32_t depth;
+		uint32_t mipMapCount;
+		uint32_t reserved1[11];
+		DDSPixelFormat pixelFormat;
+		uint32_t caps;
+		uint32_t caps2;
+		uint32_t caps3;
+		uint32_t caps4;
+		uint32_t reserved2;
+	};
+
+	struct DDSHeaderDXT10
+	{
+		uint32_t dxgiFormat;
+		uint32_t resourceDimension;
+		uint32_t miscFlag;
+		uint32_t arraySize;
+		uint32_t miscFlags2;
+	};
+
+	static_assert(sizeof(DDSHeader) == 124, "Invalid DDS_HEADER size");
+	static_assert(sizeof(DDSHeaderDXT10) == 20, "Invalid DDS_HEADER_DXT10 size");
+
+
+	bool GetBCFormatFromDXGI(uint32_t _dxgiFormat, BCFormat& _outFormat, bool& _bOutSRGB)
+	{
+		_bOutSRGB = _dxgiFormat == dxgiFormatBC1UnormSRGB || _dxgiFormat == dxgiFormatBC3UnormSRGB || _dxgiFormat == dxgiFormatBC7UnormSRGB;
+
+		switch (_dxgiFormat)
+		{
+			case dxgiFormatBC1Unorm:
+			case dxgiFormatBC1UnormSRGB:
+				_outFormat = BCFormat::BC1;
+				return true;
+			case dxgiFormatBC3Unorm:
+			case dxgiFormatBC3UnormSRGB:
+				_outFormat = BCFormat::BC3;
+				return true;
+			case dxgiFormatBC4Unorm:
+				_outFormat = BCFormat::BC4;
+				return true;
+			case dxgiFormatBC5Unorm:
+				_outFormat = BCFormat::BC5;
+				return true;
+			case dxgiFormatBC7Unorm:
+			case dxgiFormatBC7UnormSRGB:
+				_outFormat = BCFormat::BC7;
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	bool GetDXGIFormatFromFourCC(uint32_t _fourCC, uint32_t& _outDXGIFormat)
+	{
+		switch (_fourCC)
+		{
+			case MakeFourCC('D', 'X', 'T', '1'):
+				_outDXGIFormat = dxgiFormatBC1Unorm;
+				return true;
+			case MakeFourCC('D', 'X', 'T', '5'):
+				_outDXGIFormat = dxgiFormatBC3Unorm;
+				return true;
+			case MakeFourCC('A', 'T', 'I', '1'):
+			case MakeFourCC('B', 'C', '4', 'U'):
+				_outDXGIFormat = dxgiFormatBC4Unorm;
+				return true;
+			case MakeFourCC('A', 'T', 'I', '2'):
+			case MakeFourCC('B', 'C', '5', 'U'):
+				_outDXGIFormat = dxgiFormatBC5Unorm;
+				return true;
+			default:
+				return false;
+		}
+	}
+}
+
+
+uint32_t GetBCDXGIFormat(BCFormat _format, bool _bSRGB)
+{
+	switch (_format)
+	{
+		case BCFormat::BC1:
+			return _bSRGB ? dxgiFormatBC1UnormSRGB : dxgiFormatBC1Unorm;
+		case BCFormat::BC3:
+			return _bSRGB ? dxgiFormatBC3UnormSRGB : dxgiFormatBC3Unorm;
+		case BCFormat::BC4:
+			return dxgiFormatBC4Unorm;
+		case BCFormat::BC5:
+			return dxgiFormatBC5Unorm;
+		case BCFormat::BC7:
+			return _bSRGB ? dxgiFormatBC7UnormSRGB : dxgiFormatBC7Unorm;
+		default:
+			return 0u;
+	}
+}
+
+
+bool WriteDDS(const char* _path, const BCMipChain& _mips)
+{
+	if (_mips.levels.empty())
+		return false;
+
+	DDSHeader header{};
+	header.size = sizeof(DDSHeader);
+	header.flags = ddsdCaps | ddsdHeight | ddsdWidth | ddsdPixelFormat | ddsdMipMapCount | ddsdLinearSize;
+	header.height = _mips.levels[0].height;
+	header.width = _mips.levels[0].width;
+	header.pitchOrLinearSize = static_cast<uint32_t>(_mips.levels[0].rowPitch * _mips.levels[0].rowNum);
+	header.depth = 0u;
+	header.mipMapCount = static_cast<uint32_t>(_mips.levels.size());
+	header.pixelFormat.size = sizeof(DDSPixelFormat);
+	header.pixelFormat.flags = ddpfFourCC;
+	header.pixelFormat.fourCC = MakeFourCC('D', 'X', '1', '0');
+	header.caps = ddsCapsTexture | (_mips.levels.size() > 1 ? ddsCapsComplex | ddsCapsMipMap : 0u);
+
+	const DDSHeaderDXT10 headerDX10{
+		.dxgiFormat = GetBCDXGIFormat(_mips.format, _mips.bSRGB),
+		.resourceDimension = resourceDimensionTexture2D,
+		.miscFlag = 0u,
+		.arraySize = 1u,
+		.miscFlags2 = 0u,
+	};
+
+	FILE* file = std::fopen(_path, "wb");
+	if (!file)
+		return false;
+
+	bool bSuccess = std::fwrite(&ddsMagic, sizeof(ddsMagic), 1, file) == 1;
+	bSuccess &= std::fwrite(&header, sizeof(header), 1, file) == 1;
+	bSuccess &= std::fwrite(&headerDX10, sizeof(headerDX10), 1, file) == 1;
+
+	// BCMipChain levels are tightly packed, in DDS order.
+	bSuccess &= std::fwrite(_mips.data.data(), 1, _mips.data.size(), file) == _mips.data.size();
+
+	bSuccess &= std::fclose(file) == 0;
+
+	return bSuccess;
+}
+
+
+bool ParseDDS(const uint8_t* _data, uint64_t _size, DDSTexture& _outTexture)
+{
+	if (_size < sizeof(ddsMagic) + sizeof(DDSHeader))
+		return false;
+
+	uint32_t magic;
+	std::memcpy(&magic, _data, sizeof(magic));
+
+	if (magic != ddsMagic)
+		return false;
+
+	DDSHeader header;
+	std::memcpy(&header, _data + sizeof(magic), sizeof(header));
+
+	if (header.size != sizeof(DDSHeader) || header.pixelFormat.size != sizeof(DDSPixelFormat) || !(header.pixelFormat.flags & ddpfFourCC))
+		return false;
+
+	uint64_t offset = sizeof(magic) + sizeof(header);
+
+	if (header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+	{
+		if (_size < offset + sizeof(DDSHeaderDXT10))
+			return false;
+
+		DDSHeaderDXT10 headerDX10;
+		std::memcpy(&headerDX10, _data + offset, sizeof(headerDX10));
+		offset += sizeof(headerDX10);
+
+		// Single 2D texture only.
+		if (headerDX10.resourceDimension != resourceDimensionTexture2D || headerDX10.arraySize != 1u)
+			return false;
+
+		_outTexture.dxgiFormat = headerDX10.dxgiFormat;
+	}
+	else if (!GetDXGIFormatFromFourCC(header.pixelFormat.fourCC, _outTexture.dxgiFormat))
+		return false;
+
+	if (!GetBCFormatFromDXGI(_outTexture.dxgiFormat, _outTexture.format, _outTexture.bSRGB))
+		return false;
+
+	const uint32_t levelNum = (header.flags & ddsdMipMapCount) && header.mipMapCount > 0u ? header.mipMapCount : 1u;
+
+	if (header.width == 0u || header.height == 0u || levelNum > ComputeMipLevelNum(header.width, header.height))
+		return false;
+
+	std::vector<BCLevel> layout;
+	const uint64_t dataSize = ComputeBCLayout(header.width, header.height, levelNum, _outTexture.format, layout);
+
+	if (_size < offset + dataSize)
+		return false;
+
+	_outTexture.levels.resize(levelNum);
+
+	for (uint32_t i = 0; i < levelNum; ++i)
+	{
+		_outTexture.levels[i] = DDSLevel{
+			.data = _data + offset,
+			.width = layout[i].width,
+			.height = layout[i].height,
+			.rowPitch = layout[i].rowPitch,
+			.rowNum = layout[i].rowNum,
+		};
+
+		offset += layout[i].rowPitch * layout[i].rowNum;
+	}
+
+	return true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Texture/BCEncoder.hpp"
+
+/**
+* DDS container (DirectDraw Surface) with DX10 extended header.
+* Native DirectX container: the DXGI format is stored as-is and mip levels are tightly packed, level 0 first.
+* Vulkan equivalent would be KTX2 (VkFormat stored as-is).
+*
+* File layout:
+*   - 'DDS ' magic (4 bytes)
+*   - DDS_HEADER (124 bytes)
+*   - DDS_HEADER_DXT10 (20 bytes)
+*   - mip levels data.
+*/
+
+/// DXGI_FORMAT value of a BC format (without Windows headers).
+uint32_t GetBCDXGIFormat(BCFormat _format, bool _bSRGB);
+
+
+/**
+* Write a block-compressed mip chain to a .dds file.
+*/
+bool WriteDDS(const char* _path, const BCMipChain& _mips);
+
+
+/**
+* One mip level in the DDS data (views the parsed memory).
+*/
+struct DDSLevel
+{
+	const uint8_t* data = nullptr;
+
+	uint32_t width = 0u;
+	uint32_t height = 0u;
+
+	uint64_t rowPitch = 0u;
+	uint32_t rowNum = 0u;
+};
+
+struct DDSTexture
+{
+	uint32_t dxgiFormat = 0u;
+
+	BCFormat format = BCFormat::BC1;
+	bool bSRGB = false;
+
+	// Level 0 first.
+	std::vector<DDSLevel> levels;
+};
+
+/**
+* Parse a block-compressed DDS in memory (typically memory-mapped): no copy, levels point into _data.
+* Supports DX10 header (BC1/BC3/BC4/BC5/BC7) and legacy FourCC (DXT1, DXT5, ATI1/BC4U, ATI2/BC5U).
+* Return false on invalid or unsupported file.
+*/
+bool ParseDDS(const uint8_t* _data, uint64_t _size, DDSTexture& _outTexture);
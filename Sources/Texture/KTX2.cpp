@@ -0,0 +1,274 @@
+#include "Texture/KTX2.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#if BASISU_SUPPORT
+#include <mutex>
+
+#include <transcoder/basisu_transcoder.h>
+
+#include "Core/ParallelFor.hpp"
+#endif
+
+namespace
+{
+	constexpr uint8_t ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	// VkFormat values (vulkan_core.h).
+	constexpr uint32_t vkFormatUndefined = 0u;
+	constexpr uint32_t vkFormatBC1RGBUnorm = 131u;
+	constexpr uint32_t vkFormatBC1RGBSRGB = 132u;
+	constexpr uint32_t vkFormatBC1RGBAUnorm = 133u;
+	constexpr uint32_t vkFormatBC1RGBASRGB = 134u;
+	constexpr uint32_t vkFormatBC3Unorm = 137u;
+	constexpr uint32_t vkFormatBC3SRGB = 138u;
+	constexpr uint32_t vkFormatBC4Unorm = 139u;
+	constexpr uint32_t vkFormatBC5Unorm = 141u;
+	constexpr uint32_t vkFormatBC7Unorm = 145u;
+	constexpr uint32_t vkFormatBC7SRGB = 146u;
+
+	// Supercompression schemes.
+	constexpr uint32_t supercompressionNone = 0u;
+	constexpr uint32_t supercompressionBasisLZ = 1u;
+	constexpr uint32_t supercompressionZstd = 2u;
+
+	// Data format descriptor (Khronos Data Format specification).
+	constexpr uint8_t dfdColorModelETC1S = 163u;
+	constexpr uint8_t dfdColorModelUASTC = 166u;
+	constexpr uint8_t dfdTransferSRGB = 2u;
+
+	struct KTX2Header
+	{
+		uint8_t identifier[12];
+		uint32_t vkFormat;
+		uint32_t typeSize;
+		uint32_t pixelWidth;
+		uint32_t pixelHeight;
+		uint32_t pixelDepth;
+		uint32_t layerCount;
+		uint32_t faceCount;
+		uint32_t levelCount;
+		uint32_t supercompressionScheme;
+
+		uint32_t dfdByteOffset;
+		uint32_t dfdByteLength;
+		uint32_t kvdByteOffset;
+		uint32_t kvdByteLength;
+		uint64_t sgdByteOffset;
+		uint64_t sgdByteLength;
+	};
+
+	struct KTX2LevelIndex
+	{
+		uint64_t byteOffset;
+		uint64_t byteLength;
+		uint64_t uncompressedByteLength;
+	};
+
+	static_assert(sizeof(KTX2Header) == 80, "Invalid KTX2 header size");
+	static_assert(sizeof(KTX2LevelIndex) == 24, "Invalid KTX2 level index size");
+
+
+	bool GetBCFormatFromVkFormat(uint32_t _vkFormat, BCFormat& _outFormat, bool& _bOutSRGB)
+	{
+		_bOutSRGB = _vkFormat == vkFormatBC1RGBSRGB || _vkFormat == vkFormatBC1RGBASRGB || _vkFormat == vkFormatBC3SRGB || _vkFormat == vkFormatBC7SRGB;
+
+		switch (_vkFormat)
+		{
+			case vkFormatBC1RGBUnorm:
+			case vkFormatBC1RGBSRGB:
+			case vkFormatBC1RGBAUnorm:
+			case vkFormatBC1RGBASRGB:
+				_outFormat = BCFormat::BC1;
+				return true;
+			case vkFormatBC3Unorm:
+			case vkFormatBC3SRGB:
+				_outFormat = BCFormat::BC3;
+				return true;
+			case vkFormatBC4Unorm:
+				_outFormat = BCFormat::BC4;
+				return true;
+			case vkFormatBC5Unorm:
+				_outFormat = BCFormat::BC5;
+				return true;
+			case vkFormatBC7Unorm:
+			case vkFormatBC7SRGB:
+				_outFormat = BCFormat::BC7;
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	/// Read the color model and transfer function of the basic descriptor block.
+	bool ParseDFD(const uint8_t* _data, uint64_t _size, const KTX2Header& _header, uint8_t& _outColorModel, uint8_t& _outTransfer)
+	{
+		// dfdTotalSize (4 bytes), then block: vendor / type (4 bytes), version / size (4 bytes), colorModel, colorPrimaries, transferFunction, flags.
+		if (_header.dfdByteLength < 16u || static_cast<uint64_t>(_header.dfdByteOffset) + _header.dfdByteLength > _size)
+			return false;
+
+		_outColorModel = _data[_header.dfdByteOffset + 12u];
+		_outTransfer = _data[_header.dfdByteOffset + 14u];
+
+		return true;
+	}
+}
+
+
+bool ParseKTX2(const uint8_t* _data, uint64_t _size, KTX2Texture& _outTexture)
+{
+	if (_size < sizeof(KTX2Header))
+		return false;
+
+	KTX2Header header;
+	std::memcpy(&header, _data, sizeof(header));
+
+	if (std::memcmp(header.identifier, ktx2Identifier, sizeof(ktx2Identifier)) != 0)
+		return false;
+
+	// Single 2D texture only.
+	if (header.pixelWidth == 0u || header.pixelHeight == 0u || header.pixelDepth > 1u || header.layerCount > 1u || header.faceCount != 1u)
+		return false;
+
+	// levelCount 0: mip levels to generate at load, not supported (cooked textures come with their mip chain).
+	const uint32_t levelNum = header.levelCount;
+
+	if (levelNum == 0u || levelNum > ComputeMipLevelNum(header.pixelWidth, header.pixelHeight))
+		return false;
+
+	if (_size < sizeof(KTX2Header) + levelNum * sizeof(KTX2LevelIndex))
+		return false;
+
+	_outTexture.fileData = _data;
+	_outTexture.fileSize = _size;
+
+	// BC layout, only used for BC data (Basis levels are compressed).
+	std::vector<BCLevel> layout;
+
+	if (header.vkFormat != vkFormatUndefined)
+	{
+		if (header.supercompressionScheme != supercompressionNone || !GetBCFormatFromVkFormat(header.vkFormat, _outTexture.format, _outTexture.bSRGB))
+			return false;
+
+		_outTexture.encoding = KTX2Encoding::BC;
+
+		ComputeBCLayout(header.pixelWidth, header.pixelHeight, levelNum, _outTexture.format, layout);
+	}
+	else
+	{
+		uint8_t colorModel;
+		uint8_t transfer;
+
+		if (!ParseDFD(_data, _size, header, colorModel, transfer))
+			return false;
+
+		if (colorModel == dfdColorModelETC1S && header.supercompressionScheme == supercompressionBasisLZ)
+			_outTexture.encoding = KTX2Encoding::ETC1S;
+		else if (colorModel == dfdColorModelUASTC && (header.supercompressionScheme == supercompressionNone || header.supercompressionScheme == supercompressionZstd))
+			_outTexture.encoding = KTX2Encoding::UASTC;
+		else
+			return false;
+
+		_outTexture.bSRGB = transfer == dfdTransferSRGB;
+
+		// Can't be transcoded: let the caller fallback to another file.
+		if constexpr (!BASISU_SUPPORT)
+			return false;
+	}
+
+	_outTexture.levels.resize(levelNum);
+
+	for (uint32_t i = 0; i < levelNum; ++i)
+	{
+		KTX2LevelIndex index;
+		std::memcpy(&index, _data + sizeof(KTX2Header) + i * sizeof(KTX2LevelIndex), sizeof(index));
+
+		if (index.byteOffset > _size || index.byteLength > _size - index.byteOffset)
+			return false;
+
+		KTX2Level& level = _outTexture.levels[i];
+		level.data = _data + index.byteOffset;
+		level.size = index.byteLength;
+		level.width = (std::max)(1u, header.pixelWidth >> i);
+		level.height = (std::max)(1u, header.pixelHeight >> i);
+
+		if (_outTexture.encoding == KTX2Encoding::BC)
+		{
+			if (index.byteLength != layout[i].rowPitch * layout[i].rowNum)
+				return false;
+
+			level.rowPitch = layout[i].rowPitch;
+			level.rowNum = layout[i].rowNum;
+		}
+	}
+
+	return true;
+}
+
+
+bool TranscodeKTX2(const KTX2Texture& _texture, BCFormat _format, const BCLevel* _dstLevels)
+{
+#if BASISU_SUPPORT
+	if (_texture.encoding == KTX2Encoding::BC)
+		return false;
+
+	// Global tables: once per process.
+	static std::once_flag initFlag;
+	std::call_once(initFlag, []() { basist::basisu_transcoder_init(); });
+
+	basist::transcoder_texture_format targetFormat;
+
+	switch (_format)
+	{
+		case BCFormat::BC1:
+			targetFormat = basist::transcoder_texture_format::cTFBC1_RGB;
+			break;
+		case BCFormat::BC3:
+			targetFormat = basist::transcoder_texture_format::cTFBC3_RGBA;
+			break;
+		case BCFormat::BC4:
+			targetFormat = basist::transcoder_texture_format::cTFBC4_R;
+			break;
+		case BCFormat::BC5:
+			targetFormat = basist::transcoder_texture_format::cTFBC5_RG;
+			break;
+		case BCFormat::BC7:
+			targetFormat = basist::transcoder_texture_format::cTFBC7_RGBA;
+			break;
+		default:
+			return false;
+	}
+
+	basist::ktx2_transcoder transcoder;
+
+	// Parse the file again and decode the ETC1S global codebooks (shared by every level, read-only while transcoding).
+	if (!transcoder.init(_texture.fileData, static_cast<uint32_t>(_texture.fileSize)) || !transcoder.start_transcoding())
+		return false;
+
+	const uint32_t blockSize = GetBCBlockSize(_format);
+	const uint32_t levelNum = static_cast<uint32_t>(_texture.levels.size());
+
+	std::atomic<bool> bSuccess = true;
+
+	// Levels are independent: one transcoder state (per-thread scratch memory) per level.
+	ParallelFor(levelNum, [&](uint32_t _level)
+	{
+		const BCLevel& dst = _dstLevels[_level];
+		const uint32_t rowPitchInBlocks = static_cast<uint32_t>(dst.rowPitch / blockSize);
+
+		basist::ktx2_transcoder_state state;
+
+		if (!transcoder.transcode_image_level(_level, 0, 0, dst.data, rowPitchInBlocks * dst.rowNum, targetFormat, 0, rowPitchInBlocks, 0, -1, -1, &state))
+			bSuccess = false;
+	});
+
+	return bSuccess;
+#else
+	(void)_texture;
+	(void)_format;
+	(void)_dstLevels;
+
+	return false;
+#endif
+}
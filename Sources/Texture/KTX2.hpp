@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Texture/BCEncoder.hpp"
+
+/**
+* KTX2 container (Khronos): the Vulkan counterpart of DDS (VkFormat stored as-is).
+* Supported content (single 2D texture, no array, no cubemap):
+*   - BC formats (BC1 to BC7, no supercompression): GPU-native, levels copied straight into staging memory as DDS.
+*   - Basis Universal supercompressed textures (ETC1S / BasisLZ, UASTC, UASTC + Zstd): 3-6x smaller on disk than BC,
+*     transcoded to a BC format at load time (see TranscodeKTX2()).
+*
+* Basis transcoding uses the Basis Universal transcoder (ThirdParty/basis_universal submodule),
+* enabled with BASISU_SUPPORT=1 (BASISU_SUPPORT CMake option, off by default): otherwise only BC textures are supported.
+* TextureCooker writes UASTC + Zstd .ktx2 files (<output.ktx2>): CookTextures only cooks .dds.
+*
+* File layout:
+*   - identifier (12 bytes), header (68 bytes), index (level byte ranges, level 0 first).
+*   - data format descriptor (color model, transfer function), key/values, supercompression global data.
+*   - mip levels data (smallest level first in the file).
+*/
+
+#ifndef BASISU_SUPPORT
+#define BASISU_SUPPORT 0
+#endif
+
+enum class KTX2Encoding : uint8_t
+{
+	/// GPU-native BC data.
+	BC,
+
+	/// Basis Universal ETC1S (BasisLZ supercompression): smallest, lower quality.
+	ETC1S,
+
+	/// Basis Universal UASTC (optionally Zstd supercompressed): high quality.
+	UASTC,
+};
+
+/**
+* One mip level in the KTX2 data (views the parsed memory).
+* rowPitch / rowNum are only set for BC data (rows of 4x4 blocks): Basis levels must be transcoded.
+*/
+struct KTX2Level
+{
+	const uint8_t* data = nullptr;
+	uint64_t size = 0u;
+
+	uint32_t width = 0u;
+	uint32_t height = 0u;
+
+	uint64_t rowPitch = 0u;
+	uint32_t rowNum = 0u;
+};
+
+struct KTX2Texture
+{
+	/// Whole file (the Basis transcoder parses it again).
+	const uint8_t* fileData = nullptr;
+	uint64_t fileSize = 0u;
+
+	KTX2Encoding encoding = KTX2Encoding::BC;
+
+	/// Format of BC data (Basis data: chosen at transcoding).
+	BCFormat format = BCFormat::BC1;
+
+	/// sRGB data (VkFormat for BC data, data format descriptor transfer function for Basis data).
+	bool bSRGB = false;
+
+	// Level 0 first.
+	std::vector<KTX2Level> levels;
+};
+
+/**
+* Parse a KTX2 file in memory (typically memory-mapped): no copy, levels point into _data.
+* Return false on invalid or unsupported file (Basis data without BASISU_SUPPORT).
+*/
+bool ParseKTX2(const uint8_t* _data, uint64_t _size, KTX2Texture& _outTexture);
+
+/**
+* Transcode every level of a Basis texture (ETC1S / UASTC) to _format (BC1, BC3, BC4, BC5 or BC7), levels in parallel.
+* _dstLevels: one per texture level, any rowPitch (multiple of the block size): transcode straight into staging memory.
+* Thread-safe (one transcoder per call): run on load worker threads.
+* Return false on corrupted data or without BASISU_SUPPORT.
+*/
+bool TranscodeKTX2(const KTX2Texture& _texture, BCFormat _format, const BCLevel* _dstLevels);
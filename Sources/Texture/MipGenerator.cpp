@@ -0,0 +1,640 @@
+#include "Texture/MipGenerator.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "Core/CPUFeatures.hpp"
+#include "Core/ParallelFor.hpp"
+
+namespace
+{
+	// Destination rows processed per task.
+	constexpr uint32_t rowBlockSize = 32u;
+
+	// Kaiser filter parameters (NVTT defaults), width in destination texels.
+	constexpr float kaiserWidth = 3.0f;
+	constexpr float kaiserAlpha = 4.0f;
+
+
+//{ sRGB
+
+	/**
+	* sRGB <-> linear conversion tables.
+	* Linear to sRGB uses a 12-bit quantized linear input: error is below 0.5 sRGB step for the whole range.
+	*/
+	struct SRGBTables
+	{
+		float toLinear[256];
+		uint8_t toSRGB[4096];
+
+		SRGBTables()
+		{
+			for (uint32_t i = 0; i < 256; ++i)
+			{
+				const float c = i / 255.0f;
+				toLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+			}
+
+			for (uint32_t i = 0; i < 4096; ++i)
+			{
+				const float l = i / 4095.0f;
+				const float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+				toSRGB[i] = static_cast<uint8_t>(c * 255.0f + 0.5f);
+			}
+		}
+	};
+
+	const SRGBTables& GetSRGBTables()
+	{
+		static const SRGBTables tables;
+		return tables;
+	}
+
+//}
+
+
+//{ Filter taps
+
+	/**
+	* Separable 1D filter taps for a _srcSize -> _dstSize resampling.
+	* Source indices are clamped to the image edges.
+	*/
+	struct FilterTaps
+	{
+		uint32_t tapNum = 0u;
+
+		// tapNum entries per destination texel.
+		std::vector<uint32_t> indices;
+		std::vector<float> weights;
+	};
+
+	double BesselI0(double _x)
+	{
+		// Power series: sum((x/2)^2k / (k!)^2).
+		double sum = 1.0;
+		double term = 1.0;
+		const double halfX2 = _x * _x * 0.25;
+
+		for (uint32_t k = 1; k < 32; ++k)
+		{
+			term *= halfX2 / (k * k);
+			sum += term;
+
+			if (term < sum * 1e-12)
+				break;
+		}
+
+		return sum;
+	}
+
+	// _x in destination texel units.
+	float EvaluateFilter(MipFilter _filter, float _x)
+	{
+		const float absX = std::fabs(_x);
+
+		if (_filter == MipFilter::Box)
+			return absX < 0.5f ? 1.0f : 0.0f;
+
+		if (absX >= kaiserWidth)
+			return 0.0f;
+
+		constexpr float pi = 3.14159265358979f;
+		const float sinc = absX < 1e-6f ? 1.0f : std::sin(pi * absX) / (pi * absX);
+
+		const float t = absX / kaiserWidth;
+		const float window = static_cast<float>(BesselI0(kaiserAlpha * std::sqrt(1.0 - t * t)) / BesselI0(kaiserAlpha));
+
+		return sinc * window;
+	}
+
+	FilterTaps ComputeFilterTaps(uint32_t _srcSize, uint32_t _dstSize, MipFilter _filter)
+	{
+		const float scale = static_cast<float>(_srcSize) / static_cast<float>(_dstSize);
+		const float support = (_filter == MipFilter::Box ? 0.5f : kaiserWidth) * scale;
+
+		FilterTaps taps;
+		taps.tapNum = static_cast<uint32_t>(std::ceil(support * 2.0f)) + 1u;
+		taps.indices.resize(taps.tapNum * _dstSize);
+		taps.weights.resize(taps.tapNum * _dstSize);
+
+		for (uint32_t i = 0; i < _dstSize; ++i)
+		{
+			const float center = (i + 0.5f) * scale;
+			const int32_t first = static_cast<int32_t>(std::floor(center - support));
+
+			float weightSum = 0.0f;
+
+			for (uint32_t t = 0; t < taps.tapNum; ++t)
+			{
+				const int32_t srcIndex = first + static_cast<int32_t>(t);
+				const float weight = EvaluateFilter(_filter, (srcIndex + 0.5f - center) / scale);
+
+				taps.indices[i * taps.tapNum + t] = static_cast<uint32_t>(std::clamp(srcIndex, 0, static_cast<int32_t>(_srcSize) - 1));
+				taps.weights[i * taps.tapNum + t] = weight;
+
+				weightSum += weight;
+			}
+
+			for (uint32_t t = 0; t < taps.tapNum; ++t)
+				taps.weights[i * taps.tapNum + t] /= weightSum;
+		}
+
+		return taps;
+	}
+
+//}
+
+
+//{ Box Integer path
+
+	void BoxRowRGBA8_SSE2(const uint8_t* _row0, const uint8_t* _row1, uint8_t* _dst, uint32_t _dstWidth)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i rounding = _mm_set1_epi16(2);
+
+		// 4 destination texels (8 source texels, 32 bytes per row) per iteration.
+		for (uint32_t x = 0; x < _dstWidth; x += 4)
+		{
+			const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row0 + x * 8));
+			const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row0 + x * 8 + 16));
+			const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row1 + x * 8));
+			const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row1 + x * 8 + 16));
+
+			// Vertical sums in 16 bits: 2 texels per register.
+			const __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+			const __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+			const __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+			const __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+			// Horizontal sums: {t0 + t1, t2 + t3}.
+			__m128i h0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+			__m128i h1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+
+			h0 = _mm_srli_epi16(_mm_add_epi16(h0, rounding), 2);
+			h1 = _mm_srli_epi16(_mm_add_epi16(h1, rounding), 2);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + x * 4), _mm_packus_epi16(h0, h1));
+		}
+	}
+
+	TARGET_AVX2 void BoxRowRGBA8_AVX2(const uint8_t* _row0, const uint8_t* _row1, uint8_t* _dst, uint32_t _dstWidth)
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i rounding = _mm256_set1_epi16(2);
+
+		// 8 destination texels (16 source texels, 64 bytes per row) per iteration.
+		for (uint32_t x = 0; x < _dstWidth; x += 8)
+		{
+			const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row0 + x * 8));
+			const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row0 + x * 8 + 32));
+			const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row1 + x * 8));
+			const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row1 + x * 8 + 32));
+
+			// Unpack works per 128-bit lane: same as SSE2 path on both lanes.
+			const __m256i s0 = _mm256_add_epi16(_mm256_unpacklo_epi8(a0, zero), _mm256_unpacklo_epi8(b0, zero));
+			const __m256i s1 = _mm256_add_epi16(_mm256_unpackhi_epi8(a0, zero), _mm256_unpackhi_epi8(b0, zero));
+			const __m256i s2 = _mm256_add_epi16(_mm256_unpacklo_epi8(a1, zero), _mm256_unpacklo_epi8(b1, zero));
+			const __m256i s3 = _mm256_add_epi16(_mm256_unpackhi_epi8(a1, zero), _mm256_unpackhi_epi8(b1, zero));
+
+			__m256i h0 = _mm256_add_epi16(_mm256_unpacklo_epi64(s0, s1), _mm256_unpackhi_epi64(s0, s1));
+			__m256i h1 = _mm256_add_epi16(_mm256_unpacklo_epi64(s2, s3), _mm256_unpackhi_epi64(s2, s3));
+
+			h0 = _mm256_srli_epi16(_mm256_add_epi16(h0, rounding), 2);
+			h1 = _mm256_srli_epi16(_mm256_add_epi16(h1, rounding), 2);
+
+			// Pack interleaves lanes: {d0d1, d4d5, d2d3, d6d7} -> reorder 64-bit blocks.
+			const __m256i packed = _mm256_packus_epi16(h0, h1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(_dst + x * 4), _mm256_permute4x64_epi64(packed, 0xD8));
+		}
+	}
+
+	void BoxRowR8_SSE2(const uint8_t* _row0, const uint8_t* _row1, uint8_t* _dst, uint32_t _dstWidth)
+	{
+		const __m128i lowMask = _mm_set1_epi16(0x00FF);
+		const __m128i rounding = _mm_set1_epi16(2);
+
+		// 16 destination texels (32 source bytes per row) per iteration.
+		for (uint32_t x = 0; x < _dstWidth; x += 16)
+		{
+			__m128i sums[2];
+
+			for (uint32_t i = 0; i < 2; ++i)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row0 + x * 2 + i * 16));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_row1 + x * 2 + i * 16));
+
+				// Even texels are the low bytes of 16-bit lanes, odd texels the high bytes.
+				const __m128i evens = _mm_add_epi16(_mm_and_si128(a, lowMask), _mm_and_si128(b, lowMask));
+				const __m128i odds = _mm_add_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+
+				sums[i] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(evens, odds), rounding), 2);
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + x), _mm_packus_epi16(sums[0], sums[1]));
+		}
+	}
+
+	TARGET_AVX2 void BoxRowR8_AVX2(const uint8_t* _row0, const uint8_t* _row1, uint8_t* _dst, uint32_t _dstWidth)
+	{
+		const __m256i lowMask = _mm256_set1_epi16(0x00FF);
+		const __m256i rounding = _mm256_set1_epi16(2);
+
+		// 32 destination texels (64 source bytes per row) per iteration.
+		for (uint32_t x = 0; x < _dstWidth; x += 32)
+		{
+			__m256i sums[2];
+
+			for (uint32_t i = 0; i < 2; ++i)
+			{
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row0 + x * 2 + i * 32));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_row1 + x * 2 + i * 32));
+
+				const __m256i evens = _mm256_add_epi16(_mm256_and_si256(a, lowMask), _mm256_and_si256(b, lowMask));
+				const __m256i odds = _mm256_add_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+
+				sums[i] = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(evens, odds), rounding), 2);
+			}
+
+			const __m256i packed = _mm256_packus_epi16(sums[0], sums[1]);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(_dst + x), _mm256_permute4x64_epi64(packed, 0xD8));
+		}
+	}
+
+	/**
+	* Exact 2x2 box filter (with edge clamp for 1 texel wide/high sources), 8-bit integer arithmetic.
+	*/
+	void GenerateBoxInteger(const ImageView& _src, const ImageView& _dst, uint32_t _channelNum)
+	{
+		static const bool bAVX2 = CPUSupportsAVX2();
+
+		using RowFunc = void(*)(const uint8_t*, const uint8_t*, uint8_t*, uint32_t);
+		const RowFunc rowFunc = _channelNum == 4 ?
+			(bAVX2 ? BoxRowRGBA8_AVX2 : BoxRowRGBA8_SSE2) :
+			(bAVX2 ? BoxRowR8_AVX2 : BoxRowR8_SSE2);
+		const uint32_t simdStep = (_channelNum == 4 ? 4u : 16u) * (bAVX2 ? 2u : 1u);
+
+		// SIMD kernels read pairs of texels: only when the source has an even width.
+		const uint32_t simdWidth = _src.width >= 2 ? _dst.width / simdStep * simdStep : 0u;
+
+		const uint32_t blockNum = (_dst.height + rowBlockSize - 1) / rowBlockSize;
+
+		ParallelFor(blockNum, [&](uint32_t _block)
+		{
+			const uint32_t yEnd = (std::min)(_dst.height, (_block + 1) * rowBlockSize);
+
+			for (uint32_t y = _block * rowBlockSize; y < yEnd; ++y)
+			{
+				const uint8_t* const row0 = _src.data + (2 * y) * _src.rowPitch;
+				const uint8_t* const row1 = _src.data + (std::min)(2 * y + 1, _src.height - 1) * _src.rowPitch;
+				uint8_t* const dstRow = _dst.data + y * _dst.rowPitch;
+
+				if (simdWidth)
+					rowFunc(row0, row1, dstRow, simdWidth);
+
+				// Scalar tail.
+				for (uint32_t x = simdWidth; x < _dst.width; ++x)
+				{
+					const uint32_t x0 = 2 * x;
+					const uint32_t x1 = (std::min)(2 * x + 1, _src.width - 1);
+
+					for (uint32_t c = 0; c < _channelNum; ++c)
+					{
+						const uint32_t sum = row0[x0 * _channelNum + c] + row0[x1 * _channelNum + c] +
+							row1[x0 * _channelNum + c] + row1[x1 * _channelNum + c];
+
+						dstRow[x * _channelNum + c] = static_cast<uint8_t>((sum + 2) >> 2);
+					}
+				}
+			}
+		});
+	}
+
+	/**
+	* Exact 2x2 box filter for sRGB: average in linear space using the conversion tables (no intermediate float image).
+	*/
+	void GenerateBoxSRGB(const ImageView& _src, const ImageView& _dst)
+	{
+		const SRGBTables& tables = GetSRGBTables();
+
+		const uint32_t blockNum = (_dst.height + rowBlockSize - 1) / rowBlockSize;
+
+		ParallelFor(blockNum, [&](uint32_t _block)
+		{
+			const uint32_t yEnd = (std::min)(_dst.height, (_block + 1) * rowBlockSize);
+
+			for (uint32_t y = _block * rowBlockSize; y < yEnd; ++y)
+			{
+				const uint8_t* const row0 = _src.data + (2 * y) * _src.rowPitch;
+				const uint8_t* const row1 = _src.data + (std::min)(2 * y + 1, _src.height - 1) * _src.rowPitch;
+				uint8_t* const dstRow = _dst.data + y * _dst.rowPitch;
+
+				for (uint32_t x = 0; x < _dst.width; ++x)
+				{
+					const uint32_t x0 = 2 * x * 4;
+					const uint32_t x1 = (std::min)(2 * x + 1, _src.width - 1) * 4;
+
+					for (uint32_t c = 0; c < 3; ++c)
+					{
+						const float linear = tables.toLinear[row0[x0 + c]] + tables.toLinear[row0[x1 + c]] +
+							tables.toLinear[row1[x0 + c]] + tables.toLinear[row1[x1 + c]];
+
+						// 0.25 average folded in the table index scale.
+						dstRow[x * 4 + c] = tables.toSRGB[static_cast<uint32_t>(linear * (4095.0f * 0.25f) + 0.5f)];
+					}
+
+					const uint32_t alpha = row0[x0 + 3] + row0[x1 + 3] + row1[x0 + 3] + row1[x1 + 3];
+					dstRow[x * 4 + 3] = static_cast<uint8_t>((alpha + 2) >> 2);
+				}
+			}
+		});
+	}
+
+//}
+
+
+//{ Separable Float path
+
+	void DecodeRow(const uint8_t* _src, float* _dst, uint32_t _width, ImageFormat _format)
+	{
+		const uint32_t valueNum = _width * GetImageFormatChannelNum(_format);
+
+		if (_format == ImageFormat::RGBA8_SRGB)
+		{
+			const float* const toLinear = GetSRGBTables().toLinear;
+
+			for (uint32_t i = 0; i < valueNum; i += 4)
+			{
+				_dst[i] = toLinear[_src[i]];
+				_dst[i + 1] = toLinear[_src[i + 1]];
+				_dst[i + 2] = toLinear[_src[i + 2]];
+				_dst[i + 3] = _src[i + 3] * (1.0f / 255.0f);
+			}
+		}
+		else
+		{
+			for (uint32_t i = 0; i < valueNum; ++i)
+				_dst[i] = _src[i] * (1.0f / 255.0f);
+		}
+	}
+
+	void EncodeRow(const float* _src, uint8_t* _dst, uint32_t _width, ImageFormat _format)
+	{
+		const uint32_t valueNum = _width * GetImageFormatChannelNum(_format);
+
+		if (_format == ImageFormat::RGBA8_SRGB)
+		{
+			const uint8_t* const toSRGB = GetSRGBTables().toSRGB;
+
+			for (uint32_t i = 0; i < valueNum; i += 4)
+			{
+				for (uint32_t c = 0; c < 3; ++c)
+				{
+					const float linear = std::clamp(_src[i + c], 0.0f, 1.0f);
+					_dst[i + c] = toSRGB[static_cast<uint32_t>(linear * 4095.0f + 0.5f)];
+				}
+
+				_dst[i + 3] = static_cast<uint8_t>(std::clamp(_src[i + 3], 0.0f, 1.0f) * 255.0f + 0.5f);
+			}
+
+			return;
+		}
+
+		const __m128 scale = _mm_set1_ps(255.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 zero = _mm_setzero_ps();
+
+		uint32_t i = 0;
+
+		// 16 values per iteration. Negative (Kaiser ringing) and overflow values are clamped.
+		for (; i + 16 <= valueNum; i += 16)
+		{
+			__m128i ints[4];
+
+			for (uint32_t j = 0; j < 4; ++j)
+			{
+				const __m128 v = _mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(_src + i + j * 4), scale), half), zero);
+				ints[j] = _mm_cvttps_epi32(v);
+			}
+
+			const __m128i shorts0 = _mm_packs_epi32(ints[0], ints[1]);
+			const __m128i shorts1 = _mm_packs_epi32(ints[2], ints[3]);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + i), _mm_packus_epi16(shorts0, shorts1));
+		}
+
+		for (; i < valueNum; ++i)
+			_dst[i] = static_cast<uint8_t>(std::clamp(_src[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+
+	void FilterRowHorizontal(const float* _src, float* _dst, uint32_t _dstWidth, uint32_t _channelNum, const FilterTaps& _taps)
+	{
+		if (_channelNum == 4)
+		{
+			// One RGBA texel per SSE register.
+			for (uint32_t x = 0; x < _dstWidth; ++x)
+			{
+				const uint32_t* const indices = &_taps.indices[x * _taps.tapNum];
+				const float* const weights = &_taps.weights[x * _taps.tapNum];
+
+				__m128 acc = _mm_setzero_ps();
+
+				for (uint32_t t = 0; t < _taps.tapNum; ++t)
+					acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(weights[t]), _mm_loadu_ps(_src + indices[t] * 4)));
+
+				_mm_storeu_ps(_dst + x * 4, acc);
+			}
+		}
+		else
+		{
+			for (uint32_t x = 0; x < _dstWidth; ++x)
+			{
+				const uint32_t* const indices = &_taps.indices[x * _taps.tapNum];
+				const float* const weights = &_taps.weights[x * _taps.tapNum];
+
+				float acc = 0.0f;
+
+				for (uint32_t t = 0; t < _taps.tapNum; ++t)
+					acc += weights[t] * _src[indices[t] * _channelNum];
+
+				_dst[x * _channelNum] = acc;
+			}
+		}
+	}
+
+	// _dst += _weight * _src
+	void AccumulateRow_SSE2(const float* _src, float* _dst, float _weight, uint32_t _valueNum)
+	{
+		const __m128 weight = _mm_set1_ps(_weight);
+
+		uint32_t i = 0;
+
+		for (; i + 4 <= _valueNum; i += 4)
+			_mm_storeu_ps(_dst + i, _mm_add_ps(_mm_loadu_ps(_dst + i), _mm_mul_ps(weight, _mm_loadu_ps(_src + i))));
+
+		for (; i < _valueNum; ++i)
+			_dst[i] += _weight * _src[i];
+	}
+
+	TARGET_AVX2 void AccumulateRow_AVX2(const float* _src, float* _dst, float _weight, uint32_t _valueNum)
+	{
+		const __m256 weight = _mm256_set1_ps(_weight);
+
+		uint32_t i = 0;
+
+		for (; i + 8 <= _valueNum; i += 8)
+			_mm256_storeu_ps(_dst + i, _mm256_add_ps(_mm256_loadu_ps(_dst + i), _mm256_mul_ps(weight, _mm256_loadu_ps(_src + i))));
+
+		for (; i < _valueNum; ++i)
+			_dst[i] += _weight * _src[i];
+	}
+
+	/**
+	* Separable resampling in float (linear space for sRGB).
+	* Each task filters horizontally the source rows required by its block of destination rows, then vertically.
+	*/
+	void GenerateSeparableFloat(const ImageView& _src, const ImageView& _dst, ImageFormat _format, MipFilter _filter)
+	{
+		static const bool bAVX2 = CPUSupportsAVX2();
+		const auto accumulateRow = bAVX2 ? AccumulateRow_AVX2 : AccumulateRow_SSE2;
+
+		const uint32_t channelNum = GetImageFormatChannelNum(_format);
+		const uint32_t dstRowValueNum = _dst.width * channelNum;
+
+		const FilterTaps hTaps = ComputeFilterTaps(_src.width, _dst.width, _filter);
+		const FilterTaps vTaps = ComputeFilterTaps(_src.height, _dst.height, _filter);
+
+		const uint32_t blockNum = (_dst.height + rowBlockSize - 1) / rowBlockSize;
+
+		ParallelFor(blockNum, [&](uint32_t _block)
+		{
+			const uint32_t yBegin = _block * rowBlockSize;
+			const uint32_t yEnd = (std::min)(_dst.height, yBegin + rowBlockSize);
+
+			// Source rows range used by this block (taps are monotonic).
+			const uint32_t* const firstTaps = &vTaps.indices[yBegin * vTaps.tapNum];
+			const uint32_t* const lastTaps = &vTaps.indices[(yEnd - 1) * vTaps.tapNum];
+			const uint32_t srcRowBegin = *std::min_element(firstTaps, firstTaps + vTaps.tapNum);
+			const uint32_t srcRowEnd = *std::max_element(lastTaps, lastTaps + vTaps.tapNum) + 1;
+
+			std::vector<float> srcRow(_src.width * channelNum);
+			std::vector<float> hRows((srcRowEnd - srcRowBegin) * static_cast<size_t>(dstRowValueNum));
+			std::vector<float> dstRow(dstRowValueNum);
+
+			for (uint32_t sy = srcRowBegin; sy < srcRowEnd; ++sy)
+			{
+				DecodeRow(_src.data + sy * _src.rowPitch, srcRow.data(), _src.width, _format);
+				FilterRowHorizontal(srcRow.data(), &hRows[(sy - srcRowBegin) * static_cast<size_t>(dstRowValueNum)], _dst.width, channelNum, hTaps);
+			}
+
+			for (uint32_t y = yBegin; y < yEnd; ++y)
+			{
+				std::fill(dstRow.begin(), dstRow.end(), 0.0f);
+
+				for (uint32_t t = 0; t < vTaps.tapNum; ++t)
+				{
+					const float weight = vTaps.weights[y * vTaps.tapNum + t];
+
+					if (weight != 0.0f)
+					{
+						const uint32_t sy = vTaps.indices[y * vTaps.tapNum + t];
+						accumulateRow(&hRows[(sy - srcRowBegin) * static_cast<size_t>(dstRowValueNum)], dstRow.data(), weight, dstRowValueNum);
+					}
+				}
+
+				EncodeRow(dstRow.data(), _dst.data + y * _dst.rowPitch, _dst.width, _format);
+			}
+		});
+	}
+
+//}
+}
+
+
+uint32_t GetImageFormatChannelNum(ImageFormat _format)
+{
+	return _format == ImageFormat::R8 ? 1u : 4u;
+}
+
+uint32_t ComputeMipLevelNum(uint32_t _width, uint32_t _height)
+{
+	uint32_t levelNum = 1u;
+	uint32_t size = (std::max)(_width, _height);
+
+	while (size > 1u)
+	{
+		size >>= 1;
+		++levelNum;
+	}
+
+	return levelNum;
+}
+
+void GenerateMipLevel(const ImageView& _src, const ImageView& _dst, ImageFormat _format, MipFilter _filter)
+{
+	// Exact 2x reduction (or 1 texel edge): dedicated 2x2 box kernels.
+	const bool bHalfWidth = _src.width == 2 * _dst.width || _src.width == 1;
+	const bool bHalfHeight = _src.height == 2 * _dst.height || _src.height == 1;
+
+	if (_filter == MipFilter::Box && bHalfWidth && bHalfHeight)
+	{
+		if (_format == ImageFormat::RGBA8_SRGB)
+			GenerateBoxSRGB(_src, _dst);
+		else
+			GenerateBoxInteger(_src, _dst, GetImageFormatChannelNum(_format));
+	}
+	else
+		GenerateSeparableFloat(_src, _dst, _format, _filter);
+}
+
+void GenerateMipChain(const ImageView* _levels, uint32_t _levelNum, ImageFormat _format, MipFilter _filter)
+{
+	// Each level depends on the previous one: parallelism is inside each level.
+	for (uint32_t i = 1; i < _levelNum; ++i)
+		GenerateMipLevel(_levels[i - 1], _levels[i], _format, _filter);
+}
+
+MipChain AllocateMipChain(uint32_t _width, uint32_t _height, ImageFormat _format, uint32_t _levelNum)
+{
+	const uint32_t channelNum = GetImageFormatChannelNum(_format);
+	const uint32_t levelNum = _levelNum ? _levelNum : ComputeMipLevelNum(_width, _height);
+
+	MipChain chain;
+	chain.format = _format;
+	chain.levels.resize(levelNum);
+
+	uint64_t totalSize = 0u;
+
+	for (uint32_t i = 0; i < levelNum; ++i)
+	{
+		ImageView& level = chain.levels[i];
+		level.width = ComputeMipSize(_width, i);
+		level.height = ComputeMipSize(_height, i);
+		level.rowPitch = static_cast<uint64_t>(level.width) * channelNum;
+
+		totalSize += level.rowPitch * level.height;
+	}
+
+	chain.data.resize(totalSize);
+
+	uint64_t offset = 0u;
+
+	for (ImageView& level : chain.levels)
+	{
+		level.data = chain.data.data() + offset;
+		offset += level.rowPitch * level.height;
+	}
+
+	return chain;
+}
+
+MipChain CreateMipChain(const uint8_t* _data, uint32_t _width, uint32_t _height, ImageFormat _format, MipFilter _filter, uint32_t _levelNum)
+{
+	MipChain chain = AllocateMipChain(_width, _height, _format, _levelNum);
+
+	std::memcpy(chain.data.data(), _data, chain.levels[0].rowPitch * _height);
+
+	GenerateMipChain(chain.levels.data(), static_cast<uint32_t>(chain.levels.size()), _format, _filter);
+
+	return chain;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+* CPU mip chain generator.
+* Runs at texture load time (and in offline tools): multithreaded over blocks of rows, SSE2/AVX2 kernels.
+* Does not depend on any graphics API: can be benchmarked on a CPU-only machine.
+*/
+
+enum class ImageFormat : uint8_t
+{
+	R8,
+	RGBA8,
+
+	// Gamma-correct filtering: texels are converted to linear space before filtering (alpha stays linear).
+	RGBA8_SRGB,
+};
+
+uint32_t GetImageFormatChannelNum(ImageFormat _format);
+
+
+enum class MipFilter : uint8_t
+{
+	// 2x2 average. Fast integer SIMD path for RGBA8 and R8.
+	Box,
+
+	// Kaiser-windowed sinc (width 3, alpha 4): sharper mips, less aliasing.
+	Kaiser,
+};
+
+
+/**
+* View on one image (one mip level) in memory.
+* rowPitch allows to read/write directly in padded memory (ie. staging memory with 256 bytes aligned rows).
+*/
+struct ImageView
+{
+	uint8_t* data = nullptr;
+
+	uint32_t width = 0u;
+	uint32_t height = 0u;
+
+	// Bytes between two rows.
+	uint64_t rowPitch = 0u;
+};
+
+
+/// Number of levels of a full mip chain (down to 1x1).
+uint32_t ComputeMipLevelNum(uint32_t _width, uint32_t _height);
+
+/// Size of the mip level _level of a _size image.
+inline uint32_t ComputeMipSize(uint32_t _size, uint32_t _level)
+{
+	const uint32_t size = _size >> _level;
+	return size ? size : 1u;
+}
+
+
+/**
+* Generate _dst (one level down) from _src.
+* _dst size must be {max(1, _src.width / 2), max(1, _src.height / 2)}.
+*/
+void GenerateMipLevel(const ImageView& _src, const ImageView& _dst, ImageFormat _format, MipFilter _filter);
+
+/**
+* Generate levels [1, _levelNum) in place, each level from the previous one.
+* _levels[0] must be filled with the source image.
+*/
+void GenerateMipChain(const ImageView* _levels, uint32_t _levelNum, ImageFormat _format, MipFilter _filter);
+
+
+/**
+* Tightly packed mip chain owning its memory.
+*/
+struct MipChain
+{
+	ImageFormat format = ImageFormat::RGBA8;
+
+	std::vector<uint8_t> data;
+
+	// Views into data, level 0 first.
+	std::vector<ImageView> levels;
+};
+
+/**
+* Allocate a mip chain without filling it: decode the source image straight into levels[0], then GenerateMipChain().
+* _levelNum == 0 means full chain.
+*/
+MipChain AllocateMipChain(uint32_t _width, uint32_t _height, ImageFormat _format, uint32_t _levelNum = 0u);
+
+/**
+* Copy _data (tightly packed) as level 0 and generate the other levels.
+* _levelNum == 0 means full chain.
+*/
+MipChain CreateMipChain(const uint8_t* _data, uint32_t _width, uint32_t _height, ImageFormat _format, MipFilter _filter, uint32_t _levelNum = 0u);
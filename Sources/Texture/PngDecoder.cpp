@@ -0,0 +1,1336 @@
+#include "Texture/PngDecoder.hpp"
+
+#include <bit>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "Core/CPUFeatures.hpp"
+#include "Core/ParallelFor.hpp"
+
+namespace
+{
+	constexpr uint8_t pngSignature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+	/// Compressed bytes per parallel inflate segment (at least): smaller segments are not worth a thread.
+	constexpr uint64_t minSegmentSize = 256u * 1024u;
+
+	uint32_t ReadBigEndian32(const uint8_t* _data)
+	{
+		return (uint32_t(_data[0]) << 24) | (uint32_t(_data[1]) << 16) | (uint32_t(_data[2]) << 8) | uint32_t(_data[3]);
+	}
+
+
+//{ Bit reader
+
+	/**
+	* LSB-first bit reader (deflate bit order).
+	* Refill() keeps at least 56 bits in the buffer: a whole length / distance pair is decoded without refilling.
+	* Reading past the end returns zero bits (counted in mOverrun): Offset() > size means the stream is truncated.
+	*/
+	class BitReader
+	{
+	public:
+		BitReader(const uint8_t* _data, uint64_t _size) :
+			mBegin{ _data },
+			mCurr{ _data },
+			mEnd{ _data + _size }
+		{
+		}
+
+		void Refill()
+		{
+			if (mEnd - mCurr >= 8)
+			{
+				// Branchless refill: bytes above mBitNum are loaded again by the next refill (same values).
+				uint64_t word;
+				std::memcpy(&word, mCurr, sizeof(word));
+
+				mBits |= word << mBitNum;
+				mCurr += (63u - mBitNum) >> 3;
+				mBitNum |= 56u;
+			}
+			else
+			{
+				while (mBitNum <= 56u)
+				{
+					if (mCurr < mEnd)
+						mBits |= uint64_t(*mCurr++) << mBitNum;
+					else
+						++mOverrun;
+
+					mBitNum += 8u;
+				}
+			}
+		}
+
+		uint32_t Peek(uint32_t _bitNum) const
+		{
+			return static_cast<uint32_t>(mBits & ((uint64_t(1) << _bitNum) - 1u));
+		}
+
+		void Consume(uint32_t _bitNum)
+		{
+			mBits >>= _bitNum;
+			mBitNum -= _bitNum;
+		}
+
+		uint32_t Read(uint32_t _bitNum)
+		{
+			const uint32_t value = Peek(_bitNum);
+			Consume(_bitNum);
+
+			return value;
+		}
+
+		bool IsByteAligned() const
+		{
+			return (mBitNum & 7u) == 0u;
+		}
+
+		void AlignToByte()
+		{
+			Consume(mBitNum & 7u);
+		}
+
+		/// Offset of the next unread byte (byte aligned reader).
+		uint64_t Offset() const
+		{
+			return static_cast<uint64_t>(mCurr - mBegin) + mOverrun - (mBitNum >> 3);
+		}
+
+		uint64_t Size() const
+		{
+			return static_cast<uint64_t>(mEnd - mBegin);
+		}
+
+		const uint8_t* Data() const
+		{
+			return mBegin;
+		}
+
+		void Seek(uint64_t _offset)
+		{
+			mCurr = mBegin + _offset;
+			mBits = 0u;
+			mBitNum = 0u;
+			mOverrun = 0u;
+		}
+
+	private:
+		const uint8_t* mBegin = nullptr;
+		const uint8_t* mCurr = nullptr;
+		const uint8_t* mEnd = nullptr;
+
+		uint64_t mBits = 0u;
+		uint32_t mBitNum = 0u;
+		uint32_t mOverrun = 0u;
+	};
+
+//}
+
+
+//{ Huffman tables
+
+	/**
+	* Table entry (uint32):
+	*   - bits 0-3: code length to consume.
+	*   - bits 4-7: kind.
+	*   - bits 8-15: extra bits to read after the code (lengths / distances), or subtable bits.
+	*   - bits 16-31: value (literal, length / distance base, subtable offset).
+	* Zero-initialized entries are invalid (unused codes of incomplete tables).
+	*/
+	enum EntryKind : uint32_t
+	{
+		InvalidKind = 0u,
+		LiteralKind = 1u,
+		BaseKind = 2u,
+		EndOfBlockKind = 3u,
+		SubtableKind = 4u,
+	};
+
+	constexpr uint32_t MakeEntry(EntryKind _kind, uint32_t _value, uint32_t _extraBitNum = 0u)
+	{
+		return (_value << 16) | (_extraBitNum << 8) | (uint32_t(_kind) << 4);
+	}
+
+	constexpr uint32_t GetEntryLength(uint32_t _entry) { return _entry & 0xFu; }
+	constexpr EntryKind GetEntryKind(uint32_t _entry) { return EntryKind((_entry >> 4) & 0xFu); }
+	constexpr uint32_t GetEntryExtraBitNum(uint32_t _entry) { return (_entry >> 8) & 0xFFu; }
+	constexpr uint32_t GetEntryValue(uint32_t _entry) { return _entry >> 16; }
+
+	constexpr uint32_t maxCodeLength = 15u;
+
+	// Primary table bits: 10 bits cover most literal / length codes, longer codes use a subtable.
+	constexpr uint32_t litLenTableBits = 10u;
+	constexpr uint32_t distTableBits = 8u;
+	constexpr uint32_t codeLengthTableBits = 7u;
+
+	// Primary table + one subtable (max code length bits) per possible long code.
+	constexpr uint32_t litLenTableSize = (1u << litLenTableBits) + 288u * (1u << (maxCodeLength - litLenTableBits));
+	constexpr uint32_t distTableSize = (1u << distTableBits) + 32u * (1u << (maxCodeLength - distTableBits));
+	constexpr uint32_t codeLengthTableSize = 1u << codeLengthTableBits;
+
+	constexpr uint16_t lengthBases[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	constexpr uint8_t lengthExtraBits[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	constexpr uint16_t distBases[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	constexpr uint8_t distExtraBits[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	constexpr uint8_t codeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	uint32_t GetLitLenSymbolEntry(uint32_t _symbol)
+	{
+		if (_symbol < 256u)
+			return MakeEntry(LiteralKind, _symbol);
+
+		if (_symbol == 256u)
+			return MakeEntry(EndOfBlockKind, 0u);
+
+		// 286 and 287 take part in the fixed code but never appear in valid data.
+		if (_symbol - 257u < 29u)
+			return MakeEntry(BaseKind, lengthBases[_symbol - 257u], lengthExtraBits[_symbol - 257u]);
+
+		return MakeEntry(InvalidKind, 0u);
+	}
+
+	uint32_t GetDistSymbolEntry(uint32_t _symbol)
+	{
+		return _symbol < 30u ? MakeEntry(BaseKind, distBases[_symbol], distExtraBits[_symbol]) : MakeEntry(InvalidKind, 0u);
+	}
+
+	uint32_t GetCodeLengthSymbolEntry(uint32_t _symbol)
+	{
+		return MakeEntry(LiteralKind, _symbol);
+	}
+
+	uint32_t ReverseBits(uint32_t _code, uint32_t _bitNum)
+	{
+		uint32_t reversed = 0u;
+
+		for (uint32_t i = 0; i < _bitNum; ++i)
+		{
+			reversed = (reversed << 1) | (_code & 1u);
+			_code >>= 1;
+		}
+
+		return reversed;
+	}
+
+	/**
+	* Build a canonical Huffman decoding table from code lengths (RFC 1951 3.2.2).
+	* Codes up to _primaryBits are replicated in the primary table,
+	* longer codes go to a subtable per primary prefix (indexed by the remaining bits, up to the max code length).
+	* Return false on over-subscribed code. Incomplete codes are allowed (single distance code): unused entries stay invalid.
+	*/
+	template <typename SymbolEntryFuncT>
+	bool BuildHuffmanTable(const uint8_t* _lengths, uint32_t _symbolNum, uint32_t _primaryBits, SymbolEntryFuncT _symbolEntry, uint32_t* _table)
+	{
+		uint32_t counts[maxCodeLength + 1] = {};
+
+		for (uint32_t i = 0; i < _symbolNum; ++i)
+			++counts[_lengths[i]];
+
+		counts[0] = 0u;
+
+		int32_t left = 1;
+		uint32_t maxLength = 0u;
+
+		for (uint32_t length = 1; length <= maxCodeLength; ++length)
+		{
+			left = (left << 1) - static_cast<int32_t>(counts[length]);
+			if (left < 0)
+				return false;
+
+			if (counts[length])
+				maxLength = length;
+		}
+
+		uint32_t nextCodes[maxCodeLength + 1] = {};
+
+		for (uint32_t length = 1, code = 0u; length <= maxCodeLength; ++length)
+		{
+			code = (code + counts[length - 1]) << 1;
+			nextCodes[length] = code;
+		}
+
+		const uint32_t primarySize = 1u << _primaryBits;
+		const uint32_t primaryMask = primarySize - 1u;
+		const uint32_t subtableBits = maxLength > _primaryBits ? maxLength - _primaryBits : 0u;
+
+		std::memset(_table, 0, primarySize * sizeof(uint32_t));
+
+		uint32_t tableSize = primarySize;
+
+		for (uint32_t symbol = 0; symbol < _symbolNum; ++symbol)
+		{
+			const uint32_t length = _lengths[symbol];
+			if (length == 0u)
+				continue;
+
+			const uint32_t reversed = ReverseBits(nextCodes[length]++, length);
+
+			if (length <= _primaryBits)
+			{
+				const uint32_t entry = _symbolEntry(symbol) | length;
+
+				for (uint32_t i = reversed; i < primarySize; i += 1u << length)
+					_table[i] = entry;
+
+				continue;
+			}
+
+			uint32_t& primaryEntry = _table[reversed & primaryMask];
+
+			if (GetEntryKind(primaryEntry) != SubtableKind)
+			{
+				primaryEntry = MakeEntry(SubtableKind, tableSize, subtableBits) | _primaryBits;
+
+				std::memset(_table + tableSize, 0, (size_t(1) << subtableBits) * sizeof(uint32_t));
+				tableSize += 1u << subtableBits;
+			}
+
+			const uint32_t subLength = length - _primaryBits;
+			const uint32_t entry = _symbolEntry(symbol) | subLength;
+			uint32_t* const subtable = _table + GetEntryValue(primaryEntry);
+
+			for (uint32_t i = reversed >> _primaryBits; i < (1u << subtableBits); i += 1u << subLength)
+				subtable[i] = entry;
+		}
+
+		return true;
+	}
+
+	/// Decode one symbol entry (reader refilled: at least maxCodeLength bits).
+	inline uint32_t DecodeEntry(BitReader& _reader, const uint32_t* _table, uint32_t _primaryBits)
+	{
+		uint32_t entry = _table[_reader.Peek(_primaryBits)];
+
+		if (GetEntryKind(entry) == SubtableKind)
+		{
+			_reader.Consume(_primaryBits);
+			entry = _table[GetEntryValue(entry) + _reader.Peek(GetEntryExtraBitNum(entry))];
+		}
+
+		_reader.Consume(GetEntryLength(entry));
+
+		return entry;
+	}
+
+	struct InflateTables
+	{
+		uint32_t litLen[litLenTableSize];
+		uint32_t dist[distTableSize];
+	};
+
+	const InflateTables& GetFixedTables()
+	{
+		static const InflateTables tables = []()
+		{
+			InflateTables result;
+
+			uint8_t lengths[288];
+			std::memset(lengths, 8, 144);
+			std::memset(lengths + 144, 9, 112);
+			std::memset(lengths + 256, 7, 24);
+			std::memset(lengths + 280, 8, 8);
+
+			BuildHuffmanTable(lengths, 288u, litLenTableBits, GetLitLenSymbolEntry, result.litLen);
+
+			std::memset(lengths, 5, 32);
+			BuildHuffmanTable(lengths, 32u, distTableBits, GetDistSymbolEntry, result.dist);
+
+			return result;
+		}();
+
+		return tables;
+	}
+
+	bool ReadDynamicTables(BitReader& _reader, InflateTables& _tables)
+	{
+		_reader.Refill();
+
+		const uint32_t litLenNum = _reader.Read(5) + 257u;
+		const uint32_t distNum = _reader.Read(5) + 1u;
+		const uint32_t codeLengthNum = _reader.Read(4) + 4u;
+
+		if (litLenNum > 286u || distNum > 30u)
+			return false;
+
+		uint8_t codeLengths[19] = {};
+
+		for (uint32_t i = 0; i < codeLengthNum; ++i)
+		{
+			_reader.Refill();
+			codeLengths[codeLengthOrder[i]] = static_cast<uint8_t>(_reader.Read(3));
+		}
+
+		uint32_t codeLengthTable[codeLengthTableSize];
+
+		if (!BuildHuffmanTable(codeLengths, 19u, codeLengthTableBits, GetCodeLengthSymbolEntry, codeLengthTable))
+			return false;
+
+		// Literal / length and distance code lengths are a single sequence (repeats can cross).
+		uint8_t lengths[286 + 30];
+		const uint32_t lengthNum = litLenNum + distNum;
+
+		for (uint32_t i = 0; i < lengthNum;)
+		{
+			_reader.Refill();
+
+			const uint32_t entry = DecodeEntry(_reader, codeLengthTable, codeLengthTableBits);
+			if (GetEntryKind(entry) != LiteralKind)
+				return false;
+
+			const uint32_t symbol = GetEntryValue(entry);
+
+			if (symbol < 16u)
+			{
+				lengths[i++] = static_cast<uint8_t>(symbol);
+				continue;
+			}
+
+			uint8_t value = 0u;
+			uint32_t repeatNum = 0u;
+
+			if (symbol == 16u)
+			{
+				if (i == 0u)
+					return false;
+
+				value = lengths[i - 1];
+				repeatNum = 3u + _reader.Read(2);
+			}
+			else if (symbol == 17u)
+				repeatNum = 3u + _reader.Read(3);
+			else
+				repeatNum = 11u + _reader.Read(7);
+
+			if (i + repeatNum > lengthNum)
+				return false;
+
+			std::memset(lengths + i, value, repeatNum);
+			i += repeatNum;
+		}
+
+		// End of block code is required.
+		if (lengths[256] == 0u)
+			return false;
+
+		return BuildHuffmanTable(lengths, litLenNum, litLenTableBits, GetLitLenSymbolEntry, _tables.litLen) &&
+			BuildHuffmanTable(lengths + litLenNum, distNum, distTableBits, GetDistSymbolEntry, _tables.dist);
+	}
+
+//}
+
+
+//{ Inflate
+
+	/**
+	* Inflate output: [historyBegin, curr) is the decoded data matches can reference, writes go to [curr, end).
+	* progress (optional) is updated after each block for a concurrent reader of [historyBegin, progress).
+	*/
+	struct InflateOutput
+	{
+		uint8_t* historyBegin = nullptr;
+		uint8_t* curr = nullptr;
+		uint8_t* end = nullptr;
+
+		std::atomic<uint64_t>* progress = nullptr;
+	};
+
+	enum class InflateStatus
+	{
+		Error,
+
+		/// Final block decoded.
+		Final,
+
+		/// Reached the stop offset on a block boundary.
+		Boundary,
+	};
+
+	/**
+	* Copy a match of _length bytes from _distance bytes back.
+	* Fast path writes up to 15 bytes past the match (overwritten by the next symbols): requires 16 bytes of margin.
+	*/
+	inline void CopyMatch(uint8_t* _dst, uint32_t _distance, uint32_t _length, const uint8_t* _end)
+	{
+		const uint8_t* src = _dst - _distance;
+
+		if (static_cast<uint64_t>(_end - _dst) >= _length + 16u)
+		{
+			if (_distance >= 16u)
+			{
+				// Chunks never read bytes not written yet: each chunk source ends before its destination.
+				for (uint32_t i = 0; i < _length; i += 16u)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + i), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+
+				return;
+			}
+
+			if (_distance == 1u)
+			{
+				// Run of a single byte (most common short distance in images: flat areas).
+				const __m128i value = _mm_set1_epi8(static_cast<char>(*src));
+
+				for (uint32_t i = 0; i < _length; i += 16u)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + i), value);
+
+				return;
+			}
+
+			/**
+			* 8-byte chunks from a multiple of the distance >= 8 (same repeating pattern):
+			* short distances are common in images (previous pixel: 3 or 4 bytes).
+			*/
+			const uint32_t stride = _distance >= 8u ? _distance : (8u + _distance - 1u) / _distance * _distance;
+			const uint32_t head = (std::min)(stride - _distance, _length);
+
+			for (uint32_t i = 0; i < head; ++i)
+				_dst[i] = src[i];
+
+			for (uint32_t i = head; i < _length; i += 8u)
+			{
+				uint64_t chunk;
+				std::memcpy(&chunk, _dst + i - stride, sizeof(chunk));
+				std::memcpy(_dst + i, &chunk, sizeof(chunk));
+			}
+
+			return;
+		}
+
+		// Overlapping short distance (repeating pattern) or end of the output: byte by byte.
+		for (uint32_t i = 0; i < _length; ++i)
+			_dst[i] = src[i];
+	}
+
+	bool InflateHuffmanBlock(BitReader& _reader, const InflateTables& _tables, InflateOutput& _out)
+	{
+		uint8_t* dst = _out.curr;
+		const uint8_t* const end = _out.end;
+
+		for (;;)
+		{
+			// 56 bits: literal / length code (15) + length extra bits (5) + distance code (15) + distance extra bits (13).
+			_reader.Refill();
+
+			uint32_t entry = DecodeEntry(_reader, _tables.litLen, litLenTableBits);
+
+			if (GetEntryKind(entry) == LiteralKind)
+			{
+				if (dst == end)
+					return false;
+
+				*dst++ = static_cast<uint8_t>(GetEntryValue(entry));
+
+				// At least 41 bits left: decode the next symbol without refill (literal runs).
+				entry = DecodeEntry(_reader, _tables.litLen, litLenTableBits);
+
+				if (GetEntryKind(entry) == LiteralKind)
+				{
+					if (dst == end)
+						return false;
+
+					*dst++ = static_cast<uint8_t>(GetEntryValue(entry));
+					continue;
+				}
+
+				_reader.Refill();
+			}
+
+			const EntryKind kind = GetEntryKind(entry);
+
+			if (kind == EndOfBlockKind)
+				break;
+
+			if (kind != BaseKind)
+				return false;
+
+			const uint32_t length = GetEntryValue(entry) + _reader.Read(GetEntryExtraBitNum(entry));
+
+			const uint32_t distEntry = DecodeEntry(_reader, _tables.dist, distTableBits);
+			if (GetEntryKind(distEntry) != BaseKind)
+				return false;
+
+			const uint32_t distance = GetEntryValue(distEntry) + _reader.Read(GetEntryExtraBitNum(distEntry));
+
+			// Matches can't reference data before the history (independent segment or corrupted stream).
+			if (distance > static_cast<uint64_t>(dst - _out.historyBegin) || length > static_cast<uint64_t>(end - dst))
+				return false;
+
+			CopyMatch(dst, distance, length, end);
+			dst += length;
+		}
+
+		_out.curr = dst;
+
+		return true;
+	}
+
+	bool InflateStoredBlock(BitReader& _reader, InflateOutput& _out)
+	{
+		_reader.AlignToByte();
+
+		const uint64_t offset = _reader.Offset();
+		const uint8_t* const data = _reader.Data();
+
+		if (offset + 4u > _reader.Size())
+			return false;
+
+		const uint32_t length = uint32_t(data[offset]) | (uint32_t(data[offset + 1]) << 8);
+		const uint32_t lengthComplement = uint32_t(data[offset + 2]) | (uint32_t(data[offset + 3]) << 8);
+
+		if ((length ^ 0xFFFFu) != lengthComplement || offset + 4u + length > _reader.Size() || length > static_cast<uint64_t>(_out.end - _out.curr))
+			return false;
+
+		std::memcpy(_out.curr, data + offset + 4u, length);
+		_out.curr += length;
+
+		_reader.Seek(offset + 4u + length);
+
+		return true;
+	}
+
+	/**
+	* Inflate deflate blocks (raw deflate, no zlib header) until the final block,
+	* or until a block starts at _stopOffset (byte offset in the reader data).
+	*/
+	InflateStatus Inflate(BitReader& _reader, uint64_t _stopOffset, InflateOutput& _out)
+	{
+		std::unique_ptr<InflateTables> dynamicTables;
+
+		for (;;)
+		{
+			if (_reader.IsByteAligned() && _reader.Offset() == _stopOffset)
+				return InflateStatus::Boundary;
+
+			if (_reader.Offset() > _reader.Size() || (_reader.Offset() > _stopOffset))
+				return InflateStatus::Error;
+
+			_reader.Refill();
+
+			const uint32_t bFinal = _reader.Read(1);
+			const uint32_t type = _reader.Read(2);
+
+			bool bSuccess = false;
+
+			switch (type)
+			{
+				case 0u:
+					bSuccess = InflateStoredBlock(_reader, _out);
+					break;
+				case 1u:
+					bSuccess = InflateHuffmanBlock(_reader, GetFixedTables(), _out);
+					break;
+				case 2u:
+				{
+					if (!dynamicTables)
+						dynamicTables = std::make_unique<InflateTables>();
+
+					bSuccess = ReadDynamicTables(_reader, *dynamicTables) && InflateHuffmanBlock(_reader, *dynamicTables, _out);
+					break;
+				}
+				default:
+					break;
+			}
+
+			if (!bSuccess || _reader.Offset() > _reader.Size())
+				return InflateStatus::Error;
+
+			if (_out.progress)
+			{
+				_out.progress->store(static_cast<uint64_t>(_out.curr - _out.historyBegin), std::memory_order_release);
+				_out.progress->notify_one();
+			}
+
+			if (bFinal)
+				return InflateStatus::Final;
+		}
+	}
+
+	/**
+	* Candidate split points: block starts after a byte-aligned empty stored block (00 00 FF FF, zlib full / sync flush),
+	* at least _minSpacing bytes apart. Candidates are not validated here (the pattern can appear in compressed data).
+	*/
+	std::vector<uint64_t> FindSegmentStarts(const uint8_t* _data, uint64_t _size, uint64_t _minSpacing)
+	{
+		std::vector<uint64_t> starts;
+
+		uint64_t last = 0u;
+		const __m128i ones = _mm_set1_epi8(-1);
+
+		// Look for the second 0xFF of the pattern 16 bytes at a time (0xFF pairs are rare in compressed data).
+		for (uint64_t i = 3u; i + 16u <= _size; i += 16u)
+		{
+			uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(_data + i)), ones)));
+
+			while (mask)
+			{
+				const uint64_t p = i + static_cast<uint64_t>(std::countr_zero(mask));
+				mask &= mask - 1u;
+
+				if (_data[p - 1] == 0xFFu && _data[p - 2] == 0u && _data[p - 3] == 0u && p + 1u - last >= _minSpacing && p + 1u < _size)
+				{
+					last = p + 1u;
+					starts.push_back(last);
+				}
+			}
+		}
+
+		return starts;
+	}
+
+//}
+
+
+//{ Unfilter
+
+	/**
+	* PNG filters (RFC 2083 6): out = filtered + predictor(a = left, b = up, c = up-left), out-of-place.
+	* Avg / Paeth are serial along the row: SIMD works on one pixel (3 or 4 bytes) at a time. Sub is a SIMD prefix sum.
+	*/
+	enum class PngFilter : uint8_t
+	{
+		None,
+		Sub,
+		Up,
+		Avg,
+		Paeth,
+	};
+
+	/// Pixel in the low bytes of a register (no memory round trip: 3-byte copies through the stack stall store forwarding).
+	template <uint32_t pixelSize>
+	inline __m128i LoadPixel(const uint8_t* _src)
+	{
+		uint32_t value = 0u;
+
+		if constexpr (pixelSize == 3u)
+		{
+			uint16_t low = 0u;
+			std::memcpy(&low, _src, 2u);
+
+			value = low | static_cast<uint32_t>(_src[2]) << 16;
+		}
+		else
+			std::memcpy(&value, _src, pixelSize);
+
+		return _mm_cvtsi32_si128(static_cast<int>(value));
+	}
+
+	template <uint32_t pixelSize>
+	inline void StorePixel(uint8_t* _dst, __m128i _value)
+	{
+		const uint32_t value = static_cast<uint32_t>(_mm_cvtsi128_si32(_value));
+
+		if constexpr (pixelSize == 3u)
+		{
+			const uint16_t low = static_cast<uint16_t>(value);
+			std::memcpy(_dst, &low, 2u);
+
+			_dst[2] = static_cast<uint8_t>(value >> 16);
+		}
+		else
+			std::memcpy(_dst, &value, pixelSize);
+	}
+
+	void UnfilterUp(const uint8_t* _src, const uint8_t* _prev, uint8_t* _dst, uint64_t _rowSize)
+	{
+		uint64_t i = 0u;
+
+		for (; i + 16u <= _rowSize; i += 16u)
+		{
+			const __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src + i));
+			const __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_prev + i));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + i), _mm_add_epi8(src, prev));
+		}
+
+		for (; i < _rowSize; ++i)
+			_dst[i] = static_cast<uint8_t>(_src[i] + _prev[i]);
+	}
+
+	/// Broadcast the pixel in the low _pixelSize bytes of _value to a whole register.
+	template <uint32_t pixelSize>
+	inline __m128i BroadcastPixel(uint32_t _value)
+	{
+		if constexpr (pixelSize == 1u)
+			return _mm_set1_epi8(static_cast<char>(_value));
+		else if constexpr (pixelSize == 2u)
+			return _mm_set1_epi16(static_cast<short>(_value));
+		else if constexpr (pixelSize == 3u)
+		{
+			// rgbr gbrg brgb (last 4 bytes unused).
+			const int rgbr = static_cast<int>(_value | _value << 24);
+
+			return _mm_setr_epi32(rgbr, static_cast<int>(_value >> 8 | _value << 16), static_cast<int>(_value >> 16 | _value << 8), rgbr);
+		}
+		else
+			return _mm_set1_epi32(static_cast<int>(_value));
+	}
+
+	/**
+	* Sub is a prefix sum per channel: log2(pixels per register) shifted adds, then add the last pixel of the previous chunk.
+	* Chunks of 16 bytes (12 for 3 bytes per pixel: 4 whole pixels, 4 unused bytes).
+	*/
+	template <uint32_t pixelSize>
+	void UnfilterSubSIMD(const uint8_t* _src, uint8_t* _dst, uint64_t _rowSize)
+	{
+		constexpr uint32_t chunkSize = pixelSize == 3u ? 12u : 16u;
+
+		__m128i carry = _mm_setzero_si128();
+		uint64_t i = 0u;
+
+		for (; i + 16u <= _rowSize; i += chunkSize)
+		{
+			__m128i sum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src + i));
+
+			sum = _mm_add_epi8(sum, _mm_slli_si128(sum, pixelSize));
+			sum = _mm_add_epi8(sum, _mm_slli_si128(sum, 2 * pixelSize));
+
+			if constexpr (chunkSize / pixelSize > 4u)
+				sum = _mm_add_epi8(sum, _mm_slli_si128(sum, 4 * pixelSize));
+
+			if constexpr (chunkSize / pixelSize > 8u)
+				sum = _mm_add_epi8(sum, _mm_slli_si128(sum, 8 * pixelSize));
+
+			sum = _mm_add_epi8(sum, carry);
+
+			if constexpr (chunkSize == 16u)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(_dst + i), sum);
+			else
+			{
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(_dst + i), sum);
+
+				const int high = _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+				std::memcpy(_dst + i + 8u, &high, 4u);
+			}
+
+			// Last pixel: top pixelSize bytes of the last 4 bytes of the chunk.
+			const uint32_t last = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(sum, chunkSize - 4u))) >> (32u - 8u * pixelSize);
+			carry = BroadcastPixel<pixelSize>(last);
+		}
+
+		for (; i < _rowSize; ++i)
+			_dst[i] = static_cast<uint8_t>(_src[i] + (i >= pixelSize ? _dst[i - pixelSize] : 0u));
+	}
+
+	template <uint32_t pixelSize>
+	void UnfilterAvgSIMD(const uint8_t* _src, const uint8_t* _prev, uint8_t* _dst, uint64_t _rowSize)
+	{
+		const __m128i one = _mm_set1_epi8(1);
+		__m128i left = _mm_setzero_si128();
+
+		for (uint64_t i = 0u; i < _rowSize; i += pixelSize)
+		{
+			const __m128i up = LoadPixel<pixelSize>(_prev + i);
+
+			// floor((a + b) / 2): _mm_avg_epu8 rounds up, remove the rounding bit.
+			const __m128i average = _mm_sub_epi8(_mm_avg_epu8(left, up), _mm_and_si128(_mm_xor_si128(left, up), one));
+
+			left = _mm_add_epi8(LoadPixel<pixelSize>(_src + i), average);
+			StorePixel<pixelSize>(_dst + i, left);
+		}
+	}
+
+	template <uint32_t pixelSize>
+	void UnfilterPaethSIMD(const uint8_t* _src, const uint8_t* _prev, uint8_t* _dst, uint64_t _rowSize)
+	{
+		const __m128i zero = _mm_setzero_si128();
+
+		// 16-bit lanes: predictor differences don't fit in 8 bits.
+		__m128i a = zero;
+		__m128i c = zero;
+
+		for (uint64_t i = 0u; i < _rowSize; i += pixelSize)
+		{
+			const __m128i b = _mm_unpacklo_epi8(LoadPixel<pixelSize>(_prev + i), zero);
+
+			// pa = |b - c|, pb = |a - c|, pc = |a + b - 2c|.
+			const __m128i bc = _mm_sub_epi16(b, c);
+			const __m128i ac = _mm_sub_epi16(a, c);
+
+			const __m128i pa = _mm_max_epi16(bc, _mm_sub_epi16(zero, bc));
+			const __m128i pb = _mm_max_epi16(ac, _mm_sub_epi16(zero, ac));
+			const __m128i abc = _mm_add_epi16(bc, ac);
+			const __m128i pc = _mm_max_epi16(abc, _mm_sub_epi16(zero, abc));
+
+			// a if pa <= pb and pa <= pc, else b if pb <= pc, else c.
+			const __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+
+			const __m128i bIsSmallest = _mm_cmpeq_epi16(pb, smallest);
+			const __m128i bOrC = _mm_or_si128(_mm_and_si128(bIsSmallest, b), _mm_andnot_si128(bIsSmallest, c));
+
+			const __m128i aIsSmallest = _mm_cmpeq_epi16(pa, smallest);
+			const __m128i predictor = _mm_or_si128(_mm_and_si128(aIsSmallest, a), _mm_andnot_si128(aIsSmallest, bOrC));
+
+			const __m128i value = _mm_add_epi8(LoadPixel<pixelSize>(_src + i), _mm_packus_epi16(predictor, predictor));
+			StorePixel<pixelSize>(_dst + i, value);
+
+			a = _mm_unpacklo_epi8(value, zero);
+			c = b;
+		}
+	}
+
+	/// Scalar Avg (1 and 2 bytes per pixel): first pixel has no left neighbor.
+	void UnfilterAvgScalar(const uint8_t* _src, const uint8_t* _prev, uint8_t* _dst, uint64_t _rowSize, uint32_t _pixelSize)
+	{
+		uint64_t i = 0u;
+
+		for (; i < (std::min)(static_cast<uint64_t>(_pixelSize), _rowSize); ++i)
+			_dst[i] = static_cast<uint8_t>(_src[i] + (_prev[i] >> 1));
+
+		for (; i < _rowSize; ++i)
+			_dst[i] = static_cast<uint8_t>(_src[i] + ((_dst[i - _pixelSize] + _prev[i]) >> 1));
+	}
+
+	/// Scalar Paeth (1 and 2 bytes per pixel).
+	void UnfilterPaethScalar(const uint8_t* _src, const uint8_t* _prev, uint8_t* _dst, uint64_t _rowSize, uint32_t _pixelSize)
+	{
+		uint64_t i = 0u;
+
+		// a = c = 0: predictor is b.
+		for (; i < (std::min)(static_cast<uint64_t>(_pixelSize), _rowSize); ++i)
+			_dst[i] = static_cast<uint8_t>(_src[i] + _prev[i]);
+
+		for (; i < _rowSize; ++i)
+		{
+			const int32_t a = _dst[i - _pixelSize];
+			const int32_t b = _prev[i];
+			const int32_t c = _prev[i - _pixelSize];
+
+			const int32_t pa = std::abs(b - c);
+			const int32_t pb = std::abs(a - c);
+			const int32_t pc = std::abs(a + b - 2 * c);
+
+			const int32_t bOrC = pb <= pc ? b : c;
+			const int32_t predictor = pa <= pb && pa <= pc ? a : bOrC;
+
+			_dst[i] = static_cast<uint8_t>(_src[i] + predictor);
+		}
+	}
+
+	template <uint32_t pixelSize>
+	void UnfilterPixelSIMD(PngFilter _filter, const uint8_t* _src, const uint8_t* _prev, uint8_t* _dst, uint64_t _rowSize)
+	{
+		if (_filter == PngFilter::Avg)
+			UnfilterAvgSIMD<pixelSize>(_src, _prev, _dst, _rowSize);
+		else
+			UnfilterPaethSIMD<pixelSize>(_src, _prev, _dst, _rowSize);
+	}
+
+	/// _prev is the previous unfiltered row (zeros for the first row).
+	bool UnfilterRow(uint8_t _filter, const uint8_t* _src, const uint8_t* _prev, uint8_t* _dst, uint64_t _rowSize, uint32_t _pixelSize)
+	{
+		const PngFilter filter = static_cast<PngFilter>(_filter);
+
+		switch (filter)
+		{
+			case PngFilter::None:
+				std::memcpy(_dst, _src, _rowSize);
+				return true;
+			case PngFilter::Up:
+				UnfilterUp(_src, _prev, _dst, _rowSize);
+				return true;
+			case PngFilter::Sub:
+			{
+				if (_pixelSize == 4u)
+					UnfilterSubSIMD<4>(_src, _dst, _rowSize);
+				else if (_pixelSize == 3u)
+					UnfilterSubSIMD<3>(_src, _dst, _rowSize);
+				else if (_pixelSize == 2u)
+					UnfilterSubSIMD<2>(_src, _dst, _rowSize);
+				else
+					UnfilterSubSIMD<1>(_src, _dst, _rowSize);
+
+				return true;
+			}
+			case PngFilter::Avg:
+			case PngFilter::Paeth:
+				break;
+			default:
+				return false;
+		}
+
+		if (_pixelSize == 4u)
+			UnfilterPixelSIMD<4>(filter, _src, _prev, _dst, _rowSize);
+		else if (_pixelSize == 3u)
+			UnfilterPixelSIMD<3>(filter, _src, _prev, _dst, _rowSize);
+		else if (filter == PngFilter::Avg)
+			UnfilterAvgScalar(_src, _prev, _dst, _rowSize, _pixelSize);
+		else
+			UnfilterPaethScalar(_src, _prev, _dst, _rowSize, _pixelSize);
+
+		return true;
+	}
+
+	/// stb_image luminance (stbi__compute_y).
+	inline uint8_t ComputeLuminance(uint32_t _r, uint32_t _g, uint32_t _b)
+	{
+		return static_cast<uint8_t>((_r * 77u + _g * 150u + _b * 29u) >> 8);
+	}
+
+	/// Channel conversion of one row, same rules as stb_image (stbi__convert_format).
+	void ConvertRow(const uint8_t* _src, uint32_t _srcChannelNum, uint8_t* _dst, uint32_t _dstChannelNum, uint32_t _width)
+	{
+		// Common texture cases (gray or RGB to RGBA): one 32-bit store per pixel.
+		if (_dstChannelNum == 4u && _srcChannelNum == 1u)
+		{
+			for (uint32_t x = 0; x < _width; ++x)
+			{
+				const uint32_t rgba = _src[x] * 0x010101u | 0xFF000000u;
+				std::memcpy(_dst + x * 4u, &rgba, 4u);
+			}
+
+			return;
+		}
+
+		if (_dstChannelNum == 4u && _srcChannelNum == 3u && _width > 0u)
+		{
+			// 4-byte loads read the next pixel first byte: last pixel handled by the generic loop.
+			for (uint32_t x = 0; x < _width - 1u; ++x)
+			{
+				uint32_t rgba = 0u;
+				std::memcpy(&rgba, _src + x * 3u, 4u);
+
+				rgba |= 0xFF000000u;
+				std::memcpy(_dst + x * 4u, &rgba, 4u);
+			}
+
+			_src += (_width - 1u) * 3u;
+			_dst += (_width - 1u) * 4u;
+			_width = 1u;
+		}
+
+		for (uint32_t x = 0; x < _width; ++x)
+		{
+			const uint8_t* const src = _src + x * _srcChannelNum;
+			uint8_t* const dst = _dst + x * _dstChannelNum;
+
+			// Source as gray / RGB + alpha.
+			const bool bGray = _srcChannelNum <= 2u;
+			const uint8_t r = src[0];
+			const uint8_t g = bGray ? src[0] : src[1];
+			const uint8_t b = bGray ? src[0] : src[2];
+			const uint8_t alpha = _srcChannelNum == 2u ? src[1] : _srcChannelNum == 4u ? src[3] : 255u;
+
+			switch (_dstChannelNum)
+			{
+				case 1u:
+					dst[0] = bGray ? r : ComputeLuminance(r, g, b);
+					break;
+				case 2u:
+					dst[0] = bGray ? r : ComputeLuminance(r, g, b);
+					dst[1] = alpha;
+					break;
+				case 3u:
+					dst[0] = r;
+					dst[1] = g;
+					dst[2] = b;
+					break;
+				default:
+					dst[0] = r;
+					dst[1] = g;
+					dst[2] = b;
+					dst[3] = alpha;
+					break;
+			}
+		}
+	}
+
+//}
+
+
+	/**
+	* Inflate on the calling thread (single hardware thread) or on a worker thread with the calling thread unfiltering behind:
+	* _unfilterRows(availableSize) is called each time more inflated data is available, and once with ~0 on error.
+	*/
+	template <typename UnfilterRowsFuncT>
+	bool InflatePipelined(const uint8_t* _zlib, uint64_t _zlibSize, uint8_t* _filtered, uint64_t _filteredSize, UnfilterRowsFuncT&& _unfilterRows)
+	{
+		auto inflate = [&](std::atomic<uint64_t>* _progress)
+		{
+			BitReader reader(_zlib, _zlibSize);
+			reader.Seek(2u);
+
+			InflateOutput out{
+				.historyBegin = _filtered,
+				.curr = _filtered,
+				.end = _filtered + _filteredSize,
+				.progress = _progress,
+			};
+
+			// Zlib Adler-32 is not checked (as stb_image).
+			return Inflate(reader, ~0ull, out) == InflateStatus::Final && out.curr == out.end;
+		};
+
+		if (std::thread::hardware_concurrency() <= 1u)
+			return inflate(nullptr) && _unfilterRows(_filteredSize);
+
+		// Inflated size, ~0 on inflate failure.
+		std::atomic<uint64_t> progress = 0u;
+
+		std::thread inflater([&]()
+		{
+			const bool bSuccess = inflate(&progress);
+
+			progress.store(bSuccess ? _filteredSize : ~0ull, std::memory_order_release);
+			progress.notify_one();
+		});
+
+		bool bSuccess = true;
+		uint64_t available = 0u;
+
+		while (bSuccess && available < _filteredSize)
+		{
+			progress.wait(available, std::memory_order_acquire);
+			available = progress.load(std::memory_order_acquire);
+
+			bSuccess = available != ~0ull && _unfilterRows(available);
+		}
+
+		inflater.join();
+
+		return bSuccess;
+	}
+
+	/**
+	* Split the stream at independent block boundaries (see FindSegmentStarts()) and inflate segments in parallel.
+	* Return false if the stream is corrupted. Segments that can't be used are inflated sequentially.
+	*/
+	bool InflateSegments(const uint8_t* _zlib, uint64_t _zlibSize, const std::vector<uint64_t>& _segmentStarts, uint8_t* _filtered, uint64_t _filteredSize)
+	{
+		struct Segment
+		{
+			uint64_t begin = 0u;
+			uint64_t stop = ~0ull;
+
+			// Segment 0 is written in place, others in their own buffer (copied once validated).
+			std::unique_ptr<uint8_t[]> buffer;
+			uint64_t size = 0u;
+
+			InflateStatus status = InflateStatus::Error;
+		};
+
+		const uint32_t segmentNum = static_cast<uint32_t>(_segmentStarts.size()) + 1u;
+		std::vector<Segment> segments(segmentNum);
+
+		for (uint32_t i = 0; i < segmentNum; ++i)
+		{
+			segments[i].begin = i == 0u ? 2u : _segmentStarts[i - 1];
+			segments[i].stop = i + 1u < segmentNum ? _segmentStarts[i] : ~0ull;
+		}
+
+		ParallelFor(segmentNum, [&](uint32_t _index)
+		{
+			Segment& segment = segments[_index];
+
+			// Segment sizes are unknown: other segments may be as large as the whole image (untouched pages are not committed).
+			if (_index > 0u)
+				segment.buffer.reset(new uint8_t[_filteredSize]);
+
+			uint8_t* const begin = _index == 0u ? _filtered : segment.buffer.get();
+
+			BitReader reader(_zlib, _zlibSize);
+			reader.Seek(segment.begin);
+
+			InflateOutput out{
+				.historyBegin = begin,
+				.curr = begin,
+				.end = begin + _filteredSize,
+			};
+
+			segment.status = Inflate(reader, segment.stop, out);
+			segment.size = static_cast<uint64_t>(out.curr - begin);
+		});
+
+		uint8_t* dst = _filtered;
+
+		for (uint32_t i = 0; i < segmentNum; ++i)
+		{
+			const Segment& segment = segments[i];
+			const InflateStatus expected = i + 1u < segmentNum ? InflateStatus::Boundary : InflateStatus::Final;
+
+			if (segment.status != expected || segment.size > static_cast<uint64_t>(_filtered + _filteredSize - dst))
+			{
+				// Not an independent segment (or false split point): inflate sequentially from its start, with the full history.
+				BitReader reader(_zlib, _zlibSize);
+				reader.Seek(segment.begin);
+
+				InflateOutput out{
+					.historyBegin = _filtered,
+					.curr = dst,
+					.end = _filtered + _filteredSize,
+				};
+
+				return Inflate(reader, ~0ull, out) == InflateStatus::Final && out.curr == out.end;
+			}
+
+			if (i > 0u)
+				std::memcpy(dst, segment.buffer.get(), segment.size);
+
+			dst += segment.size;
+		}
+
+		return dst == _filtered + _filteredSize;
+	}
+}
+
+
+bool ParsePngHeader(const uint8_t* _data, uint64_t _size, PngInfo& _outInfo)
+{
+	// Signature + IHDR chunk (length, type, 13 bytes, CRC).
+	if (_size < 33u || std::memcmp(_data, pngSignature, sizeof(pngSignature)) != 0)
+		return false;
+
+	const uint8_t* const ihdr = _data + 8;
+
+	if (ReadBigEndian32(ihdr) != 13u || std::memcmp(ihdr + 4, "IHDR", 4) != 0)
+		return false;
+
+	_outInfo.width = ReadBigEndian32(ihdr + 8);
+	_outInfo.height = ReadBigEndian32(ihdr + 12);
+	_outInfo.bitDepth = ihdr[16];
+	_outInfo.colorType = ihdr[17];
+	_outInfo.bInterlaced = ihdr[20] != 0u;
+
+	switch (_outInfo.colorType)
+	{
+		case 0u:
+			_outInfo.channelNum = 1u;
+			break;
+		case 2u:
+			_outInfo.channelNum = 3u;
+			break;
+		case 4u:
+			_outInfo.channelNum = 2u;
+			break;
+		case 6u:
+			_outInfo.channelNum = 4u;
+			break;
+		default:
+			_outInfo.channelNum = 0u;
+			break;
+	}
+
+	// Compression and filter methods 0 are the only ones defined.
+	return _outInfo.width > 0u && _outInfo.height > 0u && ihdr[18] == 0u && ihdr[19] == 0u;
+}
+
+bool IsPngDecodeSupported(const PngInfo& _info)
+{
+	return _info.bitDepth == 8u && _info.channelNum > 0u && !_info.bInterlaced && _info.width <= (1u << 24) && _info.height <= (1u << 24);
+}
+
+bool DecodePng(const uint8_t* _data, uint64_t _size, uint32_t _channelNum, bool _bFlipVertically, const ImageView& _dst)
+{
+	PngInfo info;
+
+	if (!ParsePngHeader(_data, _size, info) || !IsPngDecodeSupported(info) || _channelNum == 0u || _channelNum > 4u)
+		return false;
+
+	if (_dst.width != info.width || _dst.height != info.height || _dst.rowPitch < uint64_t(info.width) * _channelNum)
+		return false;
+
+	// IDAT chunks form a single zlib stream: concatenated only when split in several chunks.
+	const uint8_t* zlib = nullptr;
+	uint64_t zlibSize = 0u;
+	std::vector<uint8_t> zlibConcat;
+
+	uint32_t idatNum = 0u;
+
+	for (uint64_t offset = 8u; offset + 12u <= _size;)
+	{
+		const uint64_t length = ReadBigEndian32(_data + offset);
+		const uint8_t* const type = _data + offset + 4;
+		const uint8_t* const chunkData = _data + offset + 8;
+
+		if (offset + 12u + length > _size)
+			return false;
+
+		if (std::memcmp(type, "IDAT", 4) == 0)
+		{
+			if (idatNum++ == 0u)
+			{
+				zlib = chunkData;
+				zlibSize = length;
+			}
+			else
+			{
+				if (zlibConcat.empty())
+					zlibConcat.assign(zlib, zlib + zlibSize);
+
+				zlibConcat.insert(zlibConcat.end(), chunkData, chunkData + length);
+			}
+		}
+		else if (std::memcmp(type, "IEND", 4) == 0)
+			break;
+
+		offset += 12u + length;
+	}
+
+	if (!zlibConcat.empty())
+	{
+		zlib = zlibConcat.data();
+		zlibSize = zlibConcat.size();
+	}
+
+	// Zlib header: deflate method, no preset dictionary, check bits.
+	if (zlibSize < 2u || (zlib[0] & 0x0Fu) != 8u || (zlib[1] & 0x20u) != 0u || ((uint32_t(zlib[0]) << 8) | zlib[1]) % 31u != 0u)
+		return false;
+
+	// Filtered rows: filter type byte + row data.
+	const uint32_t pixelSize = info.channelNum;
+	const uint64_t rowSize = uint64_t(info.width) * pixelSize;
+	const uint64_t filteredRowSize = rowSize + 1u;
+	const uint64_t filteredSize = filteredRowSize * info.height;
+
+	std::unique_ptr<uint8_t[]> filtered(new uint8_t[filteredSize]);
+
+	// Unfiltered rows: straight into _dst when no conversion is needed (previous row read back from _dst), else 2 rows scratch.
+	const bool bDirect = _channelNum == info.channelNum;
+
+	std::vector<uint8_t> rows((bDirect ? 1u : 3u) * rowSize, 0u);
+	const uint8_t* const zeroRow = rows.data();
+
+	auto getDstRow = [&](uint32_t _y)
+	{
+		return _dst.data + (_bFlipVertically ? info.height - 1u - _y : _y) * _dst.rowPitch;
+	};
+
+	uint32_t unfilteredRowNum = 0u;
+	const uint8_t* prevRow = zeroRow;
+
+	auto unfilterRows = [&](uint64_t _available)
+	{
+		for (; unfilteredRowNum < info.height && (unfilteredRowNum + 1u) * filteredRowSize <= _available; ++unfilteredRowNum)
+		{
+			const uint8_t* const src = filtered.get() + unfilteredRowNum * filteredRowSize;
+			uint8_t* const dstRow = getDstRow(unfilteredRowNum);
+			uint8_t* const row = bDirect ? dstRow : rows.data() + (1u + (unfilteredRowNum & 1u)) * rowSize;
+
+			if (!UnfilterRow(src[0], src + 1, prevRow, row, rowSize, pixelSize))
+				return false;
+
+			if (!bDirect)
+				ConvertRow(row, info.channelNum, dstRow, _channelNum, info.width);
+
+			prevRow = row;
+		}
+
+		return true;
+	};
+
+	const uint32_t threadNum = std::thread::hardware_concurrency();
+	const uint64_t segmentSpacing = (std::max)(minSegmentSize, zlibSize / (std::max)(threadNum, 1u));
+
+	const std::vector<uint64_t> segmentStarts = threadNum > 1u && zlibSize >= 2u * minSegmentSize ?
+		FindSegmentStarts(zlib, zlibSize, segmentSpacing) : std::vector<uint64_t>{};
+
+	if (!segmentStarts.empty())
+		return InflateSegments(zlib, zlibSize, segmentStarts, filtered.get(), filteredSize) && unfilterRows(filteredSize);
+
+	return InflatePipelined(zlib, zlibSize, filtered.get(), filteredSize, unfilterRows);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Texture/MipGenerator.hpp"
+
+/**
+* Fast PNG decoder for large textures (replaces stb_image on the .png fallback path, stb stays the fallback of this decoder).
+* Supports 8-bit, non-interlaced grayscale, grayscale + alpha, RGB and RGBA images: other files are left to stb.
+*
+* Inflate: 64-bit bit buffer with branchless refill, 2-level Huffman lookup tables (one lookup for most symbols),
+* 16-byte SSE2 copies for matches and stored blocks.
+* Unfiltering: SSE2 Up and Sub (prefix sum) for every pixel size, one pixel per SSE2 register for Avg / Paeth (3 and 4 bytes per pixel).
+*
+* Threading:
+*   - inflate runs on a worker thread while the calling thread unfilters the rows already inflated.
+*   - streams written with independent deflate blocks (zlib Z_FULL_FLUSH: byte-aligned empty stored block, no match across it)
+*     are split at these flush points and inflated in parallel (see ParallelFor).
+*     Split points are speculative: a segment is only kept if the previous segment ends exactly on it
+*     and it doesn't reference data before it, otherwise the stream is inflated sequentially from there.
+*/
+
+struct PngInfo
+{
+	uint32_t width = 0u;
+	uint32_t height = 0u;
+
+	uint32_t bitDepth = 0u;
+	uint32_t colorType = 0u;
+	bool bInterlaced = false;
+
+	/// Channels stored in the file (0 for palette images).
+	uint32_t channelNum = 0u;
+};
+
+/**
+* Parse the PNG signature and IHDR chunk.
+* Return false if _data is not a PNG file.
+*/
+bool ParsePngHeader(const uint8_t* _data, uint64_t _size, PngInfo& _outInfo);
+
+/// Return true if DecodePng() supports this file (8-bit, not interlaced, no palette).
+bool IsPngDecodeSupported(const PngInfo& _info);
+
+/**
+* Decode a PNG file in memory (typically memory-mapped) into _dst, converted to _channelNum channels (stb_image conversions).
+* _dst size must match the image size, rows are written with _dst.rowPitch (can write straight into padded memory).
+* _bFlipVertically: first row at the bottom (stbi_set_flip_vertically_on_load equivalent).
+* Return false on unsupported or corrupted file (_dst content is undefined): fallback to stb_image.
+*/
+bool DecodePng(const uint8_t* _data, uint64_t _size, uint32_t _channelNum, bool _bFlipVertically, const ImageView& _dst);
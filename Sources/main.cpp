@@ -1,4 +1,13 @@
 #include <array>
+#include <string>
+#include <vector>
+#include <deque>
+#include <cmath>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
 
 /**
 * Sapphire Suite Debugger:
@@ -15,13 +24,21 @@
 
 
 // Resource Loading
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
-
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#include "Texture/MipGenerator.hpp"
+#include "Texture/BCEncoder.hpp"
+#include "Texture/DDS.hpp"
+#include "Texture/KTX2.hpp"
+#include "Texture/PngDecoder.hpp"
+#include "Texture/ChannelPacker.hpp"
+#include "Core/MappedFile.hpp"
+#include "Mesh/MeshFile.hpp"
+#include "Mesh/Meshlet.hpp"
+#include "Mesh/GltfLoader.hpp"
+#include "Mesh/VertexQuantization.hpp"
+
 
 // Windowing
 #include <GLFW/glfw3.h>
@@ -183,6 +200,12 @@ void ValidationLayersDebugCallback(D3D12_MESSAGE_CATEGORY _category,
 // VkQueue -> ID3D12CommandQueue
 MComPtr<ID3D12CommandQueue> graphicsQueue;
 
+/**
+* Dedicated copy queue (Vulkan transfer-only queue family) for resource uploads.
+* Uploads are submitted asynchronously: rendering keeps going while assets are streamed.
+*/
+MComPtr<ID3D12CommandQueue> copyQueue;
+
 /**
 * Vulkan has native WaitForGPU method (vkDeviceWaitIdle).
 * 
@@ -193,6 +216,21 @@ HANDLE deviceFenceEvent;
 MComPtr<ID3D12Fence> deviceFence;
 uint32_t deviceFenceValue = 0u;
 
+/**
+* Upload fence: signaled by the copy queue once per executed upload batch.
+* Allows to wait for resource copies only (instead of the whole device) using the returned batch fence value.
+* The graphics queue waits on it (GPU-side) before the first use of the uploaded resources.
+*/
+HANDLE uploadFenceEvent;
+MComPtr<ID3D12Fence> uploadFence;
+uint64_t uploadFenceValue = 0u;
+
+// Last upload fence value the graphics queue has already waited on.
+uint64_t graphicsQueueUploadFenceValue = 0u;
+
+// Upload fence value of the scene resources (meshes, textures, object and lights buffers).
+uint64_t sceneUploadFenceValue = 0u;
+
 
 // VkSwapchainKHR -> IDXGISwapChain
 MComPtr<IDXGISwapChain3> swapchain;
@@ -262,277 +300,1283 @@ D3D12_RECT scissorRect;
 */
 #include <d3dcompiler.h>
 
-/**
-* VkShaderModule -> ID3DBlob
-*/
-MComPtr<ID3DBlob> litVertexShader;
-MComPtr<ID3DBlob> litPixelShader;
+/**
+* VkShaderModule -> ID3DBlob
+*/
+MComPtr<ID3DBlob> litVertexShader;
+MComPtr<ID3DBlob> litPixelShader;
+
+/**
+* VkPipelineLayout -> ID3D12RootSignature
+*/
+MComPtr<ID3D12RootSignature> litRootSign;
+
+/**
+* VkPipeline -> ID3D12PipelineState
+*/
+MComPtr<ID3D12PipelineState> litPipelineState;
+
+
+// VkBuffer -> ID3D12Resource
+std::array<MComPtr<ID3D12Resource>, 4> sphereVertexBuffers;
+/**
+* Vulkan binds the buffer directly
+* DirectX12 create 'views' (aka. how to read the memory) of buffers and use them for binding.
+*/
+std::array<D3D12_VERTEX_BUFFER_VIEW, 4> sphereVertexBufferViews;
+MComPtr<ID3D12Resource> sphereIndexBuffer;
+D3D12_INDEX_BUFFER_VIEW sphereIndexBufferView;
+/**
+* One draw per submesh: indices are relative to the submesh baseVertex (BaseVertexLocation),
+* so 16-bit index buffers are used whenever each submesh fits in 65536 vertices.
+*/
+std::vector<Submesh> sphereSubmeshes;
+/**
+* Meshlet triangles are contiguous index ranges: without mesh shaders (SM 6.5+, not available with the current FXC shaders),
+* cluster backface culling runs on CPU and draws runs of visible meshlets with DrawIndexedInstanced.
+*/
+constexpr bool bMeshletCulling = true;
+std::vector<Meshlet> sphereMeshlets;
+/**
+* Simplified levels generated by MeshCooker (see MeshSimplifier.hpp).
+* Selected each frame: coarsest level whose geometric error projects to at most lodMaxPixelError pixels.
+*/
+std::vector<MeshLOD> sphereLODs;
+constexpr float lodMaxPixelError = 1.0f;
+/**
+* Mesh bounds, computed at import (MeshCooker) and stored in the mesh file: never recomputed at runtime.
+* Submeshes have their own (Submesh::bounds / sphere), for LOD selection and culling.
+*/
+MeshBounds sphereBounds;
+
+/**
+* Compressed vertex streams (20 bytes/vertex instead of 44), see VertexQuantization.hpp:
+* 16-bit positions (dequantized with mesh bounds), octahedral normal/tangent, half UVs.
+* Must match the MeshCooker --vertex-format option (default quantized).
+*/
+constexpr bool bQuantizedVertexFormat = true;
+
+/**
+* Sphere mesh source: cooked .mesh (see MeshCooker) or binary glTF .glb, streamed from the mapped file without cooking (see GltfLoader.hpp).
+* glTF meshes are right-handed: mirrored in the object transform (no meshlets, no LODs).
+* glTF primitives must have normals, tangents and UVs (tangents are only generated by MeshCooker): other files are rejected.
+* Default path, overridden by the first command-line argument (FromVulkanToDirectX12 [path.mesh|path.glb]).
+*/
+constexpr const char* defaultSphereMeshPath = "Resources/Models/Shapes/sphere.mesh";
+bool bSphereRightHanded = false;
+
+// PBR textures.
+/**
+* Occlusion / roughness / metallic packed in one BC7 texture (R, G, B: glTF ORM convention, see ChannelPacker.hpp):
+* one descriptor, one sample and one texture fetch per pixel instead of separate metallic and roughness BC4 textures.
+* Selects the Lit root signature texture table and the ORM_TEXTURE shader variant.
+*/
+constexpr bool bORMTexture = true;
+
+/**
+* Material texture arrays: one Texture2DArray per PBR map (pbrTextureRange order), one slice per material.
+* Materials sharing map sizes and formats are selected by ObjectUBO::materialIndex:
+* every object is drawn with the same PBR descriptor table, no descriptor switch between materials.
+* Selects the MATERIAL_TEXTURE_ARRAY shader variant.
+*/
+constexpr bool bMaterialTextureArrays = true;
+std::array<MComPtr<ID3D12Resource>, 4> materialTextureArrays;
+constexpr uint32_t rustedIron2MaterialIndex = 0u;
+
+/// !bMaterialTextureArrays only: one texture per PBR map (albedo, normal, metallic / ORM, roughness: pbrTextureRange order).
+std::array<MComPtr<ID3D12Resource>, 4> rustedIron2Textures;
+
+MComPtr<ID3D12DescriptorHeap> srvHeap;
+
+// CPU mip chain generation filter (Box: fastest, Kaiser: sharper).
+constexpr MipFilter textureMipFilter = MipFilter::Box;
+
+// CPU block-compression quality (Fast: bounding box endpoints, High: refined endpoints, slowest).
+constexpr BCQuality textureBCQuality = BCQuality::Normal;
+
+
+// Camera Buffer.
+struct CameraUBO
+{
+	SA::Mat4f view;
+	SA::Mat4f invViewProj;
+};
+SA::TransformPRf cameraTr;
+constexpr float cameraMoveSpeed = 4.0f;
+constexpr float cameraRotSpeed = 16.0f;
+constexpr float cameraNear = 0.1f;
+constexpr float cameraFar = 1000.0f;
+constexpr float cameraFOV = 90.0f;
+std::array<MComPtr<ID3D12Resource>, bufferingCount> cameraBuffers;
+
+// Object Buffer.
+struct ObjectUBO
+{
+	SA::Mat4f transform;
+
+	// Quantized position dequantization (position = quantized * scale + offset).
+	SA::Vec3f positionDequantScale;
+
+	// -1 when the transform mirrors the mesh (flips the bitangent sign).
+	float tangentHandedness = 1.0f;
+
+	SA::Vec3f positionDequantOffset;
+
+	// Slice of the material texture arrays (bMaterialTextureArrays).
+	uint32_t materialIndex = 0u;
+};
+constexpr SA::Vec3f spherePosition(0.5f, 0.0f, 2.0f);
+MComPtr<ID3D12Resource> objectBuffer;
+
+// PointLights Buffer.
+struct PointLightUBO
+{
+	SA::Vec3f position;
+
+	float intensity = 0.0f;
+
+	SA::Vec3f color;
+
+	float radius = 0.0f;
+};
+MComPtr<ID3D12Resource> pointLightBuffer;
+
+// -------------------- Helper Functions --------------------
+void WaitDeviceIdle()
+{
+	// Schedule a Signal command in the queue.
+	graphicsQueue->Signal(deviceFence.Get(), deviceFenceValue);
+
+	// Wait until the fence has been processed.
+	deviceFence->SetEventOnCompletion(deviceFenceValue, deviceFenceEvent);
+	WaitForSingleObjectEx(deviceFenceEvent, INFINITE, false);
+
+	// Increment for next use.
+	++deviceFenceValue;
+}
+
+
+/**
+* Upload Batch
+* Record any number of buffer/texture copies into a single copy command list.
+* The batch is submitted only once with ExecuteUploadBatch() which returns the fence value to wait on.
+* 
+* Each batch owns its command allocator: it can only be reset once the copy queue has executed the batch.
+* Dedicated staging buffers (upload ring fallback) must also be kept alive until then.
+* Both are recycled by ReleaseCompletedUploadBatches().
+*/
+struct UploadBatch
+{
+	MComPtr<ID3D12CommandAllocator> cmdAlloc;
+	MComPtr<ID3D12GraphicsCommandList1> cmd;
+
+	std::vector<MComPtr<ID3D12Resource>> stagingBuffers;
+
+	uint64_t fenceValue = 0u;
+};
+
+// Batches submitted to the copy queue, ordered by fence value.
+std::deque<UploadBatch> submittedUploadBatches;
+
+// Executed batches: allocator and command list ready to be reset and reused.
+std::vector<UploadBatch> freeUploadBatches;
+
+
+/**
+* Upload Ring
+* One big upload heap buffer persistently mapped and sub-allocated linearly: allocating upload memory is a pointer bump.
+* Vulkan equivalent: a single HOST_VISIBLE VkBuffer kept mapped with vkMapMemory.
+* 
+* head and tail are monotonic byte counters (offset in buffer = counter % capacity).
+* Memory used by a batch is recycled once the upload fence reached the batch fence value.
+* Requests bigger than the ring (or while the ring is full of the recording batch) fall back to a dedicated staging buffer.
+*/
+struct UploadRing
+{
+	MComPtr<ID3D12Resource> buffer;
+	uint8_t* mappedData = nullptr;
+	uint64_t capacity = 0u;
+
+	uint64_t head = 0u;
+	uint64_t tail = 0u;
+
+	struct InFlightRange
+	{
+		uint64_t fenceValue = 0u;
+		uint64_t head = 0u;
+	};
+
+	// Submitted batches ranges, ordered by fence value.
+	std::deque<InFlightRange> inFlight;
+
+	// Maximum bytes in use at once (including alignment and wrap padding): use it to size the ring.
+	uint64_t highWaterMark = 0u;
+};
+constexpr uint64_t uploadRingCapacity = 64ull * 1024ull * 1024ull;
+UploadRing uploadRing;
+
+/**
+* CPU-writable upload memory returned by AllocateUploadMemory().
+* Copy source location is {buffer, offset}.
+*/
+struct UploadAllocation
+{
+	ID3D12Resource* buffer = nullptr;
+	uint64_t offset = 0u;
+	uint8_t* data = nullptr;
+};
+
+constexpr uint64_t AlignUp(uint64_t _value, uint64_t _alignment)
+{
+	return (_value + _alignment - 1) / _alignment * _alignment;
+}
+
+MComPtr<ID3D12Resource> CreateStagingBuffer(uint64_t _size)
+{
+	MComPtr<ID3D12Resource> stagingBuffer;
+
+	const D3D12_HEAP_PROPERTIES heap{
+		.Type = D3D12_HEAP_TYPE_UPLOAD,
+	};
+
+	const D3D12_RESOURCE_DESC desc{
+		.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+		.Alignment = 0,
+		.Width = _size,
+		.Height = 1,
+		.DepthOrArraySize = 1,
+		.MipLevels = 1,
+		.Format = DXGI_FORMAT_UNKNOWN,
+		.SampleDesc = {.Count = 1, .Quality = 0 },
+		.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+		.Flags = D3D12_RESOURCE_FLAG_NONE,
+	};
+
+	// Upload heap resources must be created in GENERIC_READ state.
+	const HRESULT hrStagBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&stagingBuffer));
+	if (FAILED(hrStagBufferCreated))
+	{
+		SA_LOG(L"Create Staging Buffer failed!", Error, DX12);
+		return nullptr;
+	}
+
+	return stagingBuffer;
+}
+
+/**
+* Release the ring memory of all the batches already executed by the GPU.
+*/
+void RetireUploadRing()
+{
+	const uint64_t completedValue = uploadFence->GetCompletedValue();
+
+	while (!uploadRing.inFlight.empty() && uploadRing.inFlight.front().fenceValue <= completedValue)
+	{
+		uploadRing.tail = uploadRing.inFlight.front().head;
+		uploadRing.inFlight.pop_front();
+	}
+}
+
+void WaitUploadFence(uint64_t _fenceValue);
+
+UploadAllocation AllocateUploadMemory(UploadBatch& _batch, uint64_t _size, uint64_t _alignment)
+{
+	if (_size <= uploadRing.capacity)
+	{
+		RetireUploadRing();
+
+		uint64_t offset = AlignUp(uploadRing.head, _alignment);
+
+		// Never split an allocation across the end of the ring: skip to the ring start.
+		if (offset % uploadRing.capacity + _size > uploadRing.capacity)
+			offset = AlignUp(offset, uploadRing.capacity);
+
+		// Wait for previously submitted batches to free enough memory.
+		while (offset + _size - uploadRing.tail > uploadRing.capacity && !uploadRing.inFlight.empty())
+		{
+			WaitUploadFence(uploadRing.inFlight.front().fenceValue);
+			RetireUploadRing();
+		}
+
+		// Still not enough memory: the ring is full of the batch being recorded.
+		if (offset + _size - uploadRing.tail <= uploadRing.capacity)
+		{
+			uploadRing.head = offset + _size;
+
+			if (uploadRing.head - uploadRing.tail > uploadRing.highWaterMark)
+				uploadRing.highWaterMark = uploadRing.head - uploadRing.tail;
+
+			return UploadAllocation{
+				.buffer = uploadRing.buffer.Get(),
+				.offset = offset % uploadRing.capacity,
+				.data = uploadRing.mappedData + offset % uploadRing.capacity,
+			};
+		}
+	}
+
+
+	// Fallback: dedicated staging buffer kept alive by the batch.
+	MComPtr<ID3D12Resource> stagingBuffer = CreateStagingBuffer(_size);
+	if (!stagingBuffer)
+		return UploadAllocation{};
+
+	// Memory mapping (CPU to GPU transfer).
+	const D3D12_RANGE range{ .Begin = 0, .End = 0 };
+	void* data = nullptr;
+
+	// vkMapMemory -> buffer->Map
+	const HRESULT hrMap = stagingBuffer->Map(0, &range, &data);
+	if (FAILED(hrMap))
+	{
+		SA_LOG(L"Map Staging Buffer failed!", Error, DX12);
+		return UploadAllocation{};
+	}
+
+	UploadAllocation alloc{
+		.buffer = stagingBuffer.Get(),
+		.offset = 0u,
+		.data = static_cast<uint8_t*>(data),
+	};
+
+	_batch.stagingBuffers.push_back(std::move(stagingBuffer));
+
+	return alloc;
+}
+
+/**
+* Copy-queue state handling:
+* Copy command lists can only use COPY states, resources can't be transitioned to their final (shader read) state here.
+* Resources are created in COMMON state instead:
+*   - the copy queue implicitly promotes them to COPY_DEST on copy.
+*   - they decay back to COMMON once the copy queue has executed the batch.
+*   - the graphics queue implicitly promotes them to the read state of their first use (vertex, index, shader resource).
+* Vulkan equivalent would be a queue family ownership transfer barrier.
+*/
+bool SubmitBufferToGPU(UploadBatch& _batch, MComPtr<ID3D12Resource> _gpuBuffer, uint64_t _size, const void* _data)
+{
+	const UploadAllocation staging = AllocateUploadMemory(_batch, _size, 16u);
+	if (!staging.data)
+		return false;
+
+	// Upload (CPU to GPU transfer) into persistently mapped memory.
+	std::memcpy(staging.data, _data, _size);
+
+
+	// Copy GPU staging memory to final GPU-only buffer.
+	_batch.cmd->CopyBufferRegion(_gpuBuffer.Get(), 0, staging.buffer, staging.offset, _size);
+
+	return true;
+}
+
+/**
+* Same as SubmitBufferToGPU(), but _write(void* _staging) fills the staging memory itself:
+* data converted while loading is written in place, without intermediate CPU buffer.
+* _write must return false on failure (nothing is copied).
+*/
+template <typename WriteFuncT>
+bool SubmitBufferToGPUInPlace(UploadBatch& _batch, MComPtr<ID3D12Resource> _gpuBuffer, uint64_t _size, WriteFuncT&& _write)
+{
+	const UploadAllocation staging = AllocateUploadMemory(_batch, _size, 16u);
+	if (!staging.data || !_write(static_cast<void*>(staging.data)))
+		return false;
+
+	_batch.cmd->CopyBufferRegion(_gpuBuffer.Get(), 0, staging.buffer, staging.offset, _size);
+
+	return true;
+}
+
+/**
+* Staging memory of a full texture: every subresource at its copy footprint.
+* 
+* Vulkan uses VkBufferImageCopy with bufferRowLength/bufferImageHeight.
+* DirectX12 requires row pitch to be aligned on D3D12_TEXTURE_DATA_PITCH_ALIGNMENT (256 bytes)
+* and each subresource offset on D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT (512 bytes):
+* GetCopyableFootprints() computes this staging layout for us.
+*/
+struct TextureStaging
+{
+	uint8_t* data = nullptr;
+
+	// Offsets from data.
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints;
+	std::vector<UINT> rowNums;
+	std::vector<UINT64> rowSizes;
+};
+
+/**
+* Allocate the staging memory of a full texture (every mip level of every array slice) and record its copies.
+* _outStaging.data must be filled before the batch is executed (from any thread):
+* data decoded or encoded while loading is written in place, without intermediate CPU buffer.
+*/
+bool SubmitTextureToGPUInPlace(UploadBatch& _batch, MComPtr<ID3D12Resource> _gpuTexture, uint32_t _subresourceNum, TextureStaging& _outStaging)
+{
+	const D3D12_RESOURCE_DESC desc = _gpuTexture->GetDesc();
+
+	_outStaging.footprints.resize(_subresourceNum);
+	_outStaging.rowNums.resize(_subresourceNum);
+	_outStaging.rowSizes.resize(_subresourceNum);
+	UINT64 totalSize = 0u;
+
+	device->GetCopyableFootprints(&desc, 0u, _subresourceNum, 0u, _outStaging.footprints.data(), _outStaging.rowNums.data(), _outStaging.rowSizes.data(), &totalSize);
+
+	const UploadAllocation staging = AllocateUploadMemory(_batch, totalSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+	if (!staging.data)
+		return false;
+
+	_outStaging.data = staging.data;
+
+	for (uint32_t i = 0; i < _subresourceNum; ++i)
+	{
+		// Record one copy per subresource (mip level / array slice).
+		D3D12_TEXTURE_COPY_LOCATION src{
+			.pResource = staging.buffer,
+			.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT,
+			.PlacedFootprint = _outStaging.footprints[i],
+		};
+
+		// Footprints were computed from offset 0: move to the staging allocation.
+		src.PlacedFootprint.Offset += staging.offset;
+
+		const D3D12_TEXTURE_COPY_LOCATION dst{
+			.pResource = _gpuTexture.Get(),
+			.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX,
+			.SubresourceIndex = i,
+		};
+
+		_batch.cmd->CopyTextureRegion(&dst, 0u, 0u, 0u, &src, nullptr);
+	}
+
+	return true;
+}
+
+/**
+* Copy CPU subresources into texture staging memory (one per footprint).
+* pData/RowPitch/SlicePitch describe the tightly packed (or any pitch) CPU source data of each subresource.
+*/
+void WriteSubresourcesToStaging(const TextureStaging& _staging, const D3D12_SUBRESOURCE_DATA* _subresources)
+{
+	for (size_t i = 0; i < _staging.footprints.size(); ++i)
+	{
+		const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& footprint = _staging.footprints[i];
+		const D3D12_SUBRESOURCE_DATA& subresource = _subresources[i];
+
+		// Copy row by row: source and footprint pitches differ (rows are 256 bytes aligned in staging memory).
+		for (UINT z = 0; z < footprint.Footprint.Depth; ++z)
+		{
+			uint8_t* const dstSlice = _staging.data + footprint.Offset + z * footprint.Footprint.RowPitch * _staging.rowNums[i];
+			const uint8_t* const srcSlice = static_cast<const uint8_t*>(subresource.pData) + z * subresource.SlicePitch;
+
+			for (UINT row = 0; row < _staging.rowNums[i]; ++row)
+				std::memcpy(dstSlice + row * footprint.Footprint.RowPitch, srcSlice + row * subresource.RowPitch, _staging.rowSizes[i]);
+		}
+	}
+}
+
+/**
+* Upload a full texture from CPU memory: every mip level of every array slice.
+* _subresources are ordered by subresource index (mip + arraySlice * mipLevels, see D3D12CalcSubresource).
+*/
+bool SubmitTextureToGPU(UploadBatch& _batch, MComPtr<ID3D12Resource> _gpuTexture, const D3D12_SUBRESOURCE_DATA* _subresources, uint32_t _subresourceNum)
+{
+	TextureStaging staging;
+	if (!SubmitTextureToGPUInPlace(_batch, _gpuTexture, _subresourceNum, staging))
+		return false;
+
+	WriteSubresourcesToStaging(staging, _subresources);
+
+	return true;
+}
+
+/**
+* One subresource per mip level, to use with SubmitTextureToGPU().
+*/
+std::vector<D3D12_SUBRESOURCE_DATA> GetMipChainSubresources(const MipChain& _mips)
+{
+	std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+	subresources.reserve(_mips.levels.size());
+
+	for (const ImageView& level : _mips.levels)
+	{
+		subresources.push_back(D3D12_SUBRESOURCE_DATA{
+			.pData = level.data,
+			.RowPitch = static_cast<LONG_PTR>(level.rowPitch),
+			.SlicePitch = static_cast<LONG_PTR>(level.rowPitch * level.height),
+		});
+	}
+
+	return subresources;
+}
+
+/**
+* One subresource per block-compressed mip level (BCLevel, DDSLevel or KTX2Level with BC data), to use with SubmitTextureToGPU().
+* RowPitch is the pitch of a row of 4x4 blocks (GetCopyableFootprints() counts rows of blocks for BC formats).
+* pData points into the level memory: CPU mip chain or memory-mapped .dds / .ktx2.
+*/
+template <typename LevelT>
+std::vector<D3D12_SUBRESOURCE_DATA> GetBCSubresources(const std::vector<LevelT>& _levels)
+{
+	std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+	subresources.reserve(_levels.size());
+
+	for (const LevelT& level : _levels)
+	{
+		subresources.push_back(D3D12_SUBRESOURCE_DATA{
+			.pData = level.data,
+			.RowPitch = static_cast<LONG_PTR>(level.rowPitch),
+			.SlicePitch = static_cast<LONG_PTR>(level.rowPitch * level.rowNum),
+		});
+	}
+
+	return subresources;
+}
+
+/**
+* Block-compressed level view of a subresource in texture staging memory, with the copy footprint row pitch:
+* encode or transcode straight into staging memory.
+*/
+BCLevel GetStagingBCLevel(const TextureStaging& _staging, uint32_t _index, uint32_t _width, uint32_t _height)
+{
+	return BCLevel{
+		.data = _staging.data + _staging.footprints[_index].Offset,
+		.width = _width,
+		.height = _height,
+		.rowPitch = _staging.footprints[_index].Footprint.RowPitch,
+		.rowNum = _staging.rowNums[_index],
+	};
+}
+
+/**
+* Channel-packed texture fallback (see ChannelPacker.hpp): channel i is <sourcePaths[i]>.png loaded as a single channel image,
+* or constants[i] without source.
+*/
+struct TexturePackDesc
+{
+	const char* sourcePaths[4]{};
+	uint8_t constants[4]{ 255u, 255u, 255u, 255u };
+};
+
+struct TextureFileDesc
+{
+	/// Texture path without extension (see ReadTextureHeader()).
+	const char* path = nullptr;
+
+	ImageFormat imageFormat = ImageFormat::RGBA8;
+	BCFormat bcFormat = BCFormat::BC7;
+
+	/// Unused (nullptr) for texture array slices (see TextureArrayDesc).
+	MComPtr<ID3D12Resource>* outTexture = nullptr;
+
+	/// Packed from several images when not cooked (imageFormat must be RGBA8).
+	const TexturePackDesc* pack = nullptr;
+};
+
+/**
+* Warning or error of a texture load worker thread.
+* The logger is only used from the calling thread: messages are logged once the load is done (see LogTextureLoadMessages()).
+*/
+struct TextureLoadMessage
+{
+	const wchar_t* text = nullptr;
+	bool bError = true;
+	std::string path;
+};
+
+/**
+* CPU side of a texture load: header read by ReadTextureHeader() on the calling thread, data loaded by LoadTextureData() on a worker thread.
+* Keeps the source data (file mapping or fallback BC mip chain) alive until it is copied into staging memory.
+*/
+struct TextureLoadData
+{
+	/// Cooked .dds / .ktx2 or source .png file, memory-mapped.
+	MappedFile file;
+	bool bCooked = false;
+
+	/// Source .png files of a packed texture (TextureFileDesc::pack).
+	MappedFile packFiles[4];
+
+	DDSTexture ddsTexture;
+
+	/// Parsed .ktx2 (levels empty for other files): Basis Universal data is transcoded by LoadTextureData().
+	KTX2Texture ktx2Texture;
+
+	/// Fallback BC mip chain in CPU memory (size unknown before decoding: no staging memory yet).
+	BCMipChain bcMips;
+
+	std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+	DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+	uint32_t width = 0u;
+	uint32_t height = 0u;
+	uint32_t mipLevelNum = 0u;
+
+	/// Allocated from the header before the load (see SubmitTextureToGPUInPlace()): LoadTextureData() writes straight into it.
+	TextureStaging staging;
+
+	/// Written by LoadTextureData().
+	std::vector<TextureLoadMessage> messages;
+};
+
+/**
+* Open a texture file and read its size and format from the header, without decoding it.
+* _desc.path is the texture path without extension:
+*   - <path>.dds: cooked texture (see TextureCooker), memory-mapped.
+*   - <path>.ktx2: BC data (as .dds) or Basis Universal supercompressed data (transcoded to _desc.bcFormat), memory-mapped.
+*   - <path>.png fallback (or the _desc.pack sources): decoded at load time, size from the image header (stb_image formats).
+* width is left to 0 if the size is only known after decoding (unknown header).
+*/
+bool ReadTextureHeader(const TextureFileDesc& _desc, TextureLoadData& _out)
+{
+	const std::string cookedPath = std::string(_desc.path) + ".dds";
+
+	if (_out.file.Open(cookedPath.c_str()) && ParseDDS(_out.file.GetData(), _out.file.GetSize(), _out.ddsTexture))
+	{
+		_out.bCooked = true;
+		_out.subresources = GetBCSubresources(_out.ddsTexture.levels);
+		_out.format = static_cast<DXGI_FORMAT>(_out.ddsTexture.dxgiFormat);
+		_out.width = _out.ddsTexture.levels[0].width;
+		_out.height = _out.ddsTexture.levels[0].height;
+		_out.mipLevelNum = static_cast<uint32_t>(_out.ddsTexture.levels.size());
+
+		return true;
+	}
+
+	const std::string ktx2Path = std::string(_desc.path) + ".ktx2";
+
+	if (_out.file.Open(ktx2Path.c_str()) && ParseKTX2(_out.file.GetData(), _out.file.GetSize(), _out.ktx2Texture))
+	{
+		const KTX2Texture& ktx2 = _out.ktx2Texture;
+
+		_out.bCooked = true;
+		_out.width = ktx2.levels[0].width;
+		_out.height = ktx2.levels[0].height;
+		_out.mipLevelNum = static_cast<uint32_t>(ktx2.levels.size());
+
+		if (ktx2.encoding == KTX2Encoding::BC)
+		{
+			_out.subresources = GetBCSubresources(ktx2.levels);
+			_out.format = static_cast<DXGI_FORMAT>(GetBCDXGIFormat(ktx2.format, ktx2.bSRGB));
+		}
+		else
+		{
+			// Basis data is color space agnostic: sRGB from the texture usage, as the .png fallback.
+			_out.format = static_cast<DXGI_FORMAT>(GetBCDXGIFormat(_desc.bcFormat, _desc.imageFormat == ImageFormat::RGBA8_SRGB));
+		}
+
+		return true;
+	}
+
+	_out.ktx2Texture = KTX2Texture{};
+
+	SA_LOG(L"Cooked texture not found: fallback to source image decoding.", Warning, DX12, cookedPath);
+
+	// Header of the source image (first source of a packed texture: all sources have the same size).
+	const MappedFile* header = nullptr;
+
+	if (_desc.pack)
+	{
+		for (uint32_t i = 0; i < 4u; ++i)
+		{
+			if (!_desc.pack->sourcePaths[i])
+				continue;
+
+			const std::string path = std::string(_desc.pack->sourcePaths[i]) + ".png";
+
+			if (!_out.packFiles[i].Open(path.c_str()))
+			{
+				SA_LOG(L"Texture file not found", Error, STB, path);
+				return false;
+			}
+
+			if (!header)
+				header = &_out.packFiles[i];
+		}
+
+		if (!header)
+		{
+			SA_LOG(L"Packed texture without source image", Error, DX12, _desc.path);
+			return false;
+		}
+	}
+	else
+	{
+		const std::string path = std::string(_desc.path) + ".png";
+
+		if (!_out.file.Open(path.c_str()))
+		{
+			SA_LOG(L"Texture file not found", Error, STB, path);
+			return false;
+		}
+
+		header = &_out.file;
+	}
+
+	int width, height, channels;
+	if (!stbi_info_from_memory(header->GetData(), static_cast<int>(header->GetSize()), &width, &height, &channels))
+		return true;
+
+	_out.format = static_cast<DXGI_FORMAT>(GetBCDXGIFormat(_desc.bcFormat, _desc.imageFormat == ImageFormat::RGBA8_SRGB));
+	_out.width = static_cast<uint32_t>(width);
+	_out.height = static_cast<uint32_t>(height);
+	_out.mipLevelNum = ComputeMipLevelNum(_out.width, _out.height);
+
+	return true;
+}
+
+/**
+* Decode an image file into level 0 of a new mip chain (_levelNum levels, 0 for full chain, other levels are left to GenerateMipChain()).
+* SIMD PNG decoder (see PngDecoder) straight into the level, stb_image for other formats / unsupported files.
+* Flipped as stb_image (stbi_set_flip_vertically_on_load(true)).
+*/
+bool DecodeImageFile(const MappedFile& _file, const std::string& _path, ImageFormat _format, uint32_t _levelNum, MipChain& _outMips, std::vector<TextureLoadMessage>& _outMessages)
+{
+	const uint32_t channelNum = GetImageFormatChannelNum(_format);
+
+	PngInfo pngInfo;
+	if (ParsePngHeader(_file.GetData(), _file.GetSize(), pngInfo) && IsPngDecodeSupported(pngInfo))
+	{
+		_outMips = AllocateMipChain(pngInfo.width, pngInfo.height, _format, _levelNum);
+
+		if (DecodePng(_file.GetData(), _file.GetSize(), channelNum, true, _outMips.levels[0]))
+			return true;
+
+		_outMessages.push_back({ .text = L"PNG decoding failed: fallback to stb_image.", .bError = false, .path = _path });
+	}
+
+	int inWidth, inHeight, inChannels;
+	uint8_t* inData = stbi_load_from_memory(_file.GetData(), static_cast<int>(_file.GetSize()), &inWidth, &inHeight, &inChannels, static_cast<int>(channelNum));
+	if (!inData)
+	{
+		_outMessages.push_back({ .text = L"STBI Texture Loading failed", .path = _path });
+		return false;
+	}
+
+	_outMips = AllocateMipChain(static_cast<uint32_t>(inWidth), static_cast<uint32_t>(inHeight), _format, _levelNum);
+	std::memcpy(_outMips.levels[0].data, inData, _outMips.levels[0].rowPitch * _outMips.levels[0].height);
+
+	stbi_image_free(inData);
+
+	return true;
+}
+
+/**
+* Decode the sources of a packed texture and pack them into level 0 of a new full mip chain.
+*/
+bool DecodePackedImageFiles(const TextureFileDesc& _desc, TextureLoadData& _data, MipChain& _outMips)
+{
+	MipChain sources[4];
+	ChannelSource channels[4];
+
+	uint32_t width = 0u;
+	uint32_t height = 0u;
+
+	for (uint32_t i = 0; i < 4u; ++i)
+	{
+		channels[i].constant = _desc.pack->constants[i];
+
+		if (!_desc.pack->sourcePaths[i])
+			continue;
+
+		const std::string path = std::string(_desc.pack->sourcePaths[i]) + ".png";
+
+		if (!DecodeImageFile(_data.packFiles[i], path, ImageFormat::R8, 1u, sources[i], _data.messages))
+			return false;
+
+		const ImageView& source = sources[i].levels[0];
+
+		if (width == 0u)
+		{
+			width = source.width;
+			height = source.height;
+		}
+		else if (source.width != width || source.height != height)
+		{
+			_data.messages.push_back({ .text = L"Packed texture sources must have the same size", .path = path });
+			return false;
+		}
+
+		channels[i].data = source.data;
+	}
+
+	_outMips = AllocateMipChain(width, height, _desc.imageFormat);
+
+	PackChannels(channels, _outMips.levels[0]);
+
+	return true;
+}
+
+/**
+* Load the full mip chain (block-compressed) of a texture opened by ReadTextureHeader(), without any D3D12 call: safe to run on a worker thread.
+*   - .dds / BC .ktx2: subresources are copied straight from the file mapping into staging memory, no decode.
+*   - Basis Universal .ktx2: every level is transcoded to BC straight into staging memory (fast: block to block, no encoding search).
+*   - .png: decode straight into the mip chain level 0 (or decode and pack the sources of a packed texture), CPU mip chain,
+*     BC encoding straight into staging memory (slow).
+* Without staging memory (size unknown before decoding), the BC mip chain is kept in _out.bcMips / _out.subresources instead.
+* Warnings and errors are returned in _out.messages (no logging from worker threads).
+*/
+bool LoadTextureData(const TextureFileDesc& _desc, TextureLoadData& _out)
+{
+	// Cooked texture size is always known from its header: staging memory is allocated.
+	if (_out.bCooked)
+	{
+		const KTX2Texture& ktx2 = _out.ktx2Texture;
+
+		if (!ktx2.levels.empty() && ktx2.encoding != KTX2Encoding::BC)
+		{
+			std::vector<BCLevel> stagingLevels(ktx2.levels.size());
+
+			for (uint32_t i = 0; i < stagingLevels.size(); ++i)
+				stagingLevels[i] = GetStagingBCLevel(_out.staging, i, ktx2.levels[i].width, ktx2.levels[i].height);
+
+			if (!TranscodeKTX2(ktx2, _desc.bcFormat, stagingLevels.data()))
+			{
+				_out.messages.push_back({ .text = L"KTX2 Basis Universal transcoding failed", .path = _desc.path });
+				return false;
+			}
+
+			return true;
+		}
+
+		WriteSubresourcesToStaging(_out.staging, _out.subresources.data());
+		return true;
+	}
+
+	MipChain mips;
+
+	if (_desc.pack)
+	{
+		if (!DecodePackedImageFiles(_desc, _out, mips))
+			return false;
+	}
+	else if (!DecodeImageFile(_out.file, std::string(_desc.path) + ".png", _desc.imageFormat, 0u, mips, _out.messages))
+		return false;
+
+	// Generate the full mip chain on CPU.
+	GenerateMipChain(mips.levels.data(), static_cast<uint32_t>(mips.levels.size()), _desc.imageFormat, textureMipFilter);
+
+	if (_out.staging.data)
+	{
+		if (mips.levels[0].width != _out.width || mips.levels[0].height != _out.height || mips.levels.size() != _out.staging.footprints.size())
+		{
+			_out.messages.push_back({ .text = L"Decoded image size doesn't match its header", .path = _desc.path });
+			return false;
+		}
+
+		// Encode straight into staging memory, with the copy footprint row pitch.
+		std::vector<BCLevel> stagingLevels(mips.levels.size());
+
+		for (uint32_t i = 0; i < stagingLevels.size(); ++i)
+			stagingLevels[i] = GetStagingBCLevel(_out.staging, i, mips.levels[i].width, mips.levels[i].height);
+
+		EncodeMipChainBC(mips, stagingLevels.data(), _desc.bcFormat, textureBCQuality);
+
+		return true;
+	}
+
+	_out.bcMips = EncodeMipChainBC(mips, _desc.bcFormat, textureBCQuality);
+
+	_out.subresources = GetBCSubresources(_out.bcMips.levels);
+	_out.format = static_cast<DXGI_FORMAT>(GetBCDXGIFormat(_out.bcMips.format, _out.bcMips.bSRGB));
+	_out.width = mips.levels[0].width;
+	_out.height = mips.levels[0].height;
+	_out.mipLevelNum = static_cast<uint32_t>(mips.levels.size());
+
+	return true;
+}
+
+/// Log the messages of a finished texture load (calling thread only).
+void LogTextureLoadMessages(const TextureLoadData& _data)
+{
+	for (const TextureLoadMessage& message : _data.messages)
+	{
+		if (message.bError)
+		{
+			SA_LOG(message.text, Error, STB, message.path);
+		}
+		else
+		{
+			SA_LOG(message.text, Warning, STB, message.path);
+		}
+	}
+}
+
+/**
+* Create a texture (or a texture array of _arraySize slices) from its loaded header in COMMON state (main thread only).
+*/
+bool CreateTexture(const TextureLoadData& _data, const std::string& _path, MComPtr<ID3D12Resource>& _outTexture, uint32_t _arraySize = 1u)
+{
+	const D3D12_HEAP_PROPERTIES heap{
+		.Type = D3D12_HEAP_TYPE_DEFAULT,
+	};
+
+	const D3D12_RESOURCE_DESC desc{
+		.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+		.Alignment = 0,
+		.Width = _data.width,
+		.Height = _data.height,
+		.DepthOrArraySize = static_cast<UINT16>(_arraySize),
+		.MipLevels = static_cast<UINT16>(_data.mipLevelNum),
+		.Format = _data.format,
+		.SampleDesc = {.Count = 1, .Quality = 0 },
+		.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
+		.Flags = D3D12_RESOURCE_FLAG_NONE,
+	};
+
+	const HRESULT hrTextureCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&_outTexture));
+	if (FAILED(hrTextureCreated))
+	{
+		SA_LOG(L"Create Texture failed!", Error, DX12, _path);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+* Texture load pipeline:
+* the calling thread reads the header of every texture: when its size is known, it creates the texture, allocates its staging memory
+* and records the upload right away, the load then writes straight into staging memory (no intermediate copy, no double memory peak).
+* Every texture is loaded by its own task (std::async: decode, mip chain and BC encoding run in parallel).
+* Textures with an unknown size are loaded in CPU memory, created and copied into staging memory as soon as their task is done, in completion order.
+* D3D12 resources and the upload batch are only used from the calling thread.
+*/
+bool CreateTexturesFromFiles(UploadBatch& _batch, const TextureFileDesc* _descs, uint32_t _descNum)
+{
+	// Declared before the tasks: destroyed after them (std::async futures wait for their task on destruction).
+	std::vector<TextureLoadData> loads(_descNum);
+
+	// Indices of the finished tasks, in completion order.
+	std::mutex completedMutex;
+	std::condition_variable completedCondition;
+	std::vector<uint32_t> completed;
+	completed.reserve(_descNum);
+
+	std::vector<std::future<bool>> tasks;
+	tasks.reserve(_descNum);
+
+	for (uint32_t i = 0; i < _descNum; ++i)
+	{
+		const TextureFileDesc& desc = _descs[i];
+		TextureLoadData& load = loads[i];
+
+		if (!ReadTextureHeader(desc, load))
+			return false;
+
+		if (load.width != 0u)
+		{
+			if (!CreateTexture(load, desc.path, *desc.outTexture))
+				return false;
+
+			if (!SubmitTextureToGPUInPlace(_batch, *desc.outTexture, load.mipLevelNum, load.staging))
+			{
+				SA_LOG(L"Texture submit failed!", Error, DX12, desc.path);
+				return false;
+			}
+		}
+
+		tasks.push_back(std::async(std::launch::async, [_descs, &loads, &completedMutex, &completedCondition, &completed, i]()
+		{
+			const bool bLoaded = LoadTextureData(_descs[i], loads[i]);
+
+			{
+				std::lock_guard lock(completedMutex);
+				completed.push_back(i);
+			}
+
+			completedCondition.notify_one();
+
+			return bLoaded;
+		}));
+	}
+
+	for (uint32_t uploadedNum = 0; uploadedNum < _descNum; ++uploadedNum)
+	{
+		uint32_t readyIndex;
+
+		// Sleep until the next task is done, whichever it is.
+		{
+			std::unique_lock lock(completedMutex);
+			completedCondition.wait(lock, [&completed, uploadedNum]() { return completed.size() > uploadedNum; });
+
+			readyIndex = completed[uploadedNum];
+		}
+
+		const TextureFileDesc& desc = _descs[readyIndex];
+		TextureLoadData& load = loads[readyIndex];
 
-/**
-* VkPipelineLayout -> ID3D12RootSignature
-*/
-MComPtr<ID3D12RootSignature> litRootSign;
+		const bool bLoaded = tasks[readyIndex].get();
 
-/**
-* VkPipeline -> ID3D12PipelineState
-*/
-MComPtr<ID3D12PipelineState> litPipelineState;
+		LogTextureLoadMessages(load);
 
+		if (!bLoaded)
+			return false;
 
-// VkBuffer -> ID3D12Resource
-std::array<MComPtr<ID3D12Resource>, 4> sphereVertexBuffers;
-/**
-* Vulkan binds the buffer directly
-* DirectX12 create 'views' (aka. how to read the memory) of buffers and use them for binding.
-*/
-std::array<D3D12_VERTEX_BUFFER_VIEW, 4> sphereVertexBufferViews;
-uint32_t sphereIndexCount = 0u;
-MComPtr<ID3D12Resource> sphereIndexBuffer;
-D3D12_INDEX_BUFFER_VIEW sphereIndexBufferView;
+		// Size unknown before decoding: create and copy into staging memory now.
+		if (!load.staging.data)
+		{
+			if (!CreateTexture(load, desc.path, *desc.outTexture))
+				return false;
 
-// PBR textures.
-MComPtr<ID3D12Resource> rustedIron2AlbedoTexture;
-MComPtr<ID3D12Resource> rustedIron2NormalTexture;
-MComPtr<ID3D12Resource> rustedIron2MetallicTexture;
-MComPtr<ID3D12Resource> rustedIron2RoughnessTexture;
-MComPtr<ID3D12DescriptorHeap> srvHeap;
+			if (!SubmitTextureToGPU(_batch, *desc.outTexture, load.subresources.data(), load.mipLevelNum))
+			{
+				SA_LOG(L"Texture submit failed!", Error, DX12, desc.path);
+				return false;
+			}
+		}
 
+		// Source data is in staging memory: release it now (mappings or fallback mip chain).
+		load.file.Close();
 
-// Camera Buffer.
-struct CameraUBO
-{
-	SA::Mat4f view;
-	SA::Mat4f invViewProj;
-};
-SA::TransformPRf cameraTr;
-constexpr float cameraMoveSpeed = 4.0f;
-constexpr float cameraRotSpeed = 16.0f;
-constexpr float cameraNear = 0.1f;
-constexpr float cameraFar = 1000.0f;
-constexpr float cameraFOV = 90.0f;
-std::array<MComPtr<ID3D12Resource>, bufferingCount> cameraBuffers;
+		for (MappedFile& packFile : load.packFiles)
+			packFile.Close();
+		load.bcMips = BCMipChain{};
+	}
 
-// Object Buffer.
-struct ObjectUBO
+	return true;
+}
+
+/**
+* Texture2DArray built from one texture file per slice.
+*/
+struct TextureArrayDesc
 {
-	SA::Mat4f transform;
+	/// One texture per slice (outTexture unused): same size, mip count and format.
+	const TextureFileDesc* slices = nullptr;
+	uint32_t sliceNum = 0u;
+
+	MComPtr<ID3D12Resource>* outTexture = nullptr;
 };
-constexpr SA::Vec3f spherePosition(0.5f, 0.0f, 2.0f);
-MComPtr<ID3D12Resource> objectBuffer;
 
-// PointLights Buffer.
-struct PointLightUBO
+/**
+* Texture array load pipeline (see CreateTexturesFromFiles()):
+* the calling thread reads the header of every slice, creates each array and allocates its staging memory (one upload per array),
+* then every slice of every array is loaded by its own task straight into its subresources of the staging memory.
+* Slice sizes must be known from their header (cooked textures or source images): no CPU fallback copy.
+*/
+bool CreateTextureArraysFromFiles(UploadBatch& _batch, const TextureArrayDesc* _descs, uint32_t _descNum)
 {
-	SA::Vec3f position;
+	uint32_t sliceTotalNum = 0u;
 
-	float intensity = 0.0f;
+	for (uint32_t i = 0; i < _descNum; ++i)
+		sliceTotalNum += _descs[i].sliceNum;
 
-	SA::Vec3f color;
+	// Declared before the tasks: destroyed after them (std::async futures wait for their task on destruction).
+	std::vector<TextureLoadData> loads(sliceTotalNum);
 
-	float radius = 0.0f;
-};
-MComPtr<ID3D12Resource> pointLightBuffer;
+	std::vector<std::future<bool>> tasks;
+	tasks.reserve(sliceTotalNum);
 
-// -------------------- Helper Functions --------------------
-void WaitDeviceIdle()
-{
-	// Schedule a Signal command in the queue.
-	graphicsQueue->Signal(deviceFence.Get(), deviceFenceValue);
+	uint32_t loadOffset = 0u;
 
-	// Wait until the fence has been processed.
-	deviceFence->SetEventOnCompletion(deviceFenceValue, deviceFenceEvent);
-	WaitForSingleObjectEx(deviceFenceEvent, INFINITE, false);
+	for (uint32_t i = 0; i < _descNum; ++i)
+	{
+		const TextureArrayDesc& desc = _descs[i];
+		TextureLoadData* const sliceLoads = loads.data() + loadOffset;
 
-	// Increment for next use.
-	++deviceFenceValue;
-}
+		if (desc.sliceNum == 0u)
+			continue;
 
+		for (uint32_t slice = 0; slice < desc.sliceNum; ++slice)
+		{
+			const TextureLoadData& load = sliceLoads[slice];
 
-bool SubmitBufferToGPU(MComPtr<ID3D12Resource> _gpuBuffer, uint64_t _size, const void* _data, D3D12_RESOURCE_STATES _stateAfter)
-{
-	// Create temp upload buffer.
-	MComPtr<ID3D12Resource> stagingBuffer;
+			if (!ReadTextureHeader(desc.slices[slice], sliceLoads[slice]))
+				return false;
 
-	const D3D12_HEAP_PROPERTIES heap{
-		.Type = D3D12_HEAP_TYPE_UPLOAD,
-	};
+			if (load.width == 0u || load.width != sliceLoads[0].width || load.height != sliceLoads[0].height ||
+				load.mipLevelNum != sliceLoads[0].mipLevelNum || load.format != sliceLoads[0].format)
+			{
+				SA_LOG(L"Texture array slices must have the same size, mip count and format (known from their header)", Error, DX12, desc.slices[slice].path);
+				return false;
+			}
+		}
 
-	const D3D12_RESOURCE_DESC desc{
-		.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
-		.Alignment = 0,
-		.Width = _size,
-		.Height = 1,
-		.DepthOrArraySize = 1,
-		.MipLevels = 1,
-		.Format = DXGI_FORMAT_UNKNOWN,
-		.SampleDesc = {.Count = 1, .Quality = 0 },
-		.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
-		.Flags = D3D12_RESOURCE_FLAG_NONE,
-	};
+		const uint32_t mipLevelNum = sliceLoads[0].mipLevelNum;
 
-	const HRESULT hrStagBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COPY_SOURCE, nullptr, IID_PPV_ARGS(&stagingBuffer));
-	if (FAILED(hrStagBufferCreated))
-	{
-		SA_LOG(L"Create Staging Buffer failed!", Error, DX12);
-		return false;
-	}
+		if (!CreateTexture(sliceLoads[0], desc.slices[0].path, *desc.outTexture, desc.sliceNum))
+			return false;
 
+		TextureStaging staging;
+		if (!SubmitTextureToGPUInPlace(_batch, *desc.outTexture, mipLevelNum * desc.sliceNum, staging))
+		{
+			SA_LOG(L"Texture array submit failed!", Error, DX12, desc.slices[0].path);
+			return false;
+		}
 
-	// Memory mapping and Upload (CPU to GPU transfer).
-	const D3D12_RANGE range{ .Begin = 0, .End = 0 };
-	void* data = nullptr;
+		for (uint32_t slice = 0; slice < desc.sliceNum; ++slice)
+		{
+			// Subresource index is mip + slice * mipLevelNum (D3D12CalcSubresource): each slice owns a contiguous range of footprints.
+			const uint32_t first = slice * mipLevelNum;
+			TextureStaging& sliceStaging = sliceLoads[slice].staging;
 
-	// vkMapMemory -> buffer->Map
-	stagingBuffer->Map(0, &range, reinterpret_cast<void**>(&data));
+			sliceStaging.data = staging.data;
+			sliceStaging.footprints.assign(staging.footprints.begin() + first, staging.footprints.begin() + first + mipLevelNum);
+			sliceStaging.rowNums.assign(staging.rowNums.begin() + first, staging.rowNums.begin() + first + mipLevelNum);
+			sliceStaging.rowSizes.assign(staging.rowSizes.begin() + first, staging.rowSizes.begin() + first + mipLevelNum);
 
-	std::memcpy(data, _data, _size);
+			const TextureFileDesc* const sliceDesc = &desc.slices[slice];
+			TextureLoadData* const sliceLoad = &sliceLoads[slice];
 
-	// vkUnmapMemory -> buffer->Unmap
-	stagingBuffer->Unmap(0, nullptr);
+			tasks.push_back(std::async(std::launch::async, [sliceDesc, sliceLoad]()
+			{
+				return LoadTextureData(*sliceDesc, *sliceLoad);
+			}));
+		}
 
+		loadOffset += desc.sliceNum;
+	}
 
-	// Copy GPU temp staging buffer to final GPU-only buffer.
-	cmdLists[0]->CopyBufferRegion(_gpuBuffer.Get(), 0, stagingBuffer.Get(), 0, _size);
+	// Every slice must be in staging memory before the batch is executed.
+	bool bSuccess = true;
 
+	for (std::future<bool>& task : tasks)
+		bSuccess &= task.get();
 
-	// Resource transition to final state.
-	const D3D12_RESOURCE_BARRIER barrier{
-		.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-		.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-		.Transition = {
-			.pResource = _gpuBuffer.Get(),
-			.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
-			.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
-			.StateAfter = _stateAfter,
-		},
-	};
+	for (const TextureLoadData& load : loads)
+		LogTextureLoadMessages(load);
 
-	cmdLists[0]->ResourceBarrier(1, &barrier);
+	return bSuccess;
+}
 
-	cmdLists[0]->Close();
+/**
+* Get a recycled (or new) copy command allocator and list, ready for recording.
+*/
+bool BeginUploadBatch(UploadBatch& _batch)
+{
+	if (!freeUploadBatches.empty())
+	{
+		_batch = std::move(freeUploadBatches.back());
+		freeUploadBatches.pop_back();
 
-	/**
-	* Instant command submit execution (easy implementation)
-	* Better code would parallelize resources loading in staging buffer and submit only once at the end to execute all GPU copies.
-	*/
+		_batch.cmdAlloc->Reset();
+		_batch.cmd->Reset(_batch.cmdAlloc.Get(), nullptr);
 
-	ID3D12CommandList* cmdListsArr[] = { cmdLists[0].Get() };
-	graphicsQueue->ExecuteCommandLists(1, cmdListsArr);
+		return true;
+	}
 
-	WaitDeviceIdle();
+	const HRESULT hrCmdAllocCreated = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&_batch.cmdAlloc));
+	if (FAILED(hrCmdAllocCreated))
+	{
+		SA_LOG(L"Create Copy Command Allocator failed!", Error, DX12);
+		return false;
+	}
 
-	cmdAllocs[0]->Reset();
-	cmdLists[0]->Reset(cmdAllocs[0].Get(), nullptr);
+	// Created in recording state.
+	const HRESULT hrCmdListCreated = device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, _batch.cmdAlloc.Get(), nullptr, IID_PPV_ARGS(&_batch.cmd));
+	if (FAILED(hrCmdListCreated))
+	{
+		SA_LOG(L"Create Copy Command List failed!", Error, DX12);
+		return false;
+	}
 
 	return true;
 }
 
-bool SubmitTextureToGPU(MComPtr<ID3D12Resource> _gpuTexture, int _width, int _height, int _channelNum, DXGI_FORMAT _format, const void* _data, D3D12_RESOURCE_STATES _stateAfter)
+/**
+* Close and submit the batch command list to the copy queue (asynchronous: no CPU wait).
+* Return the upload fence value signaled when all the copies of the batch are executed.
+* The batch is moved to the submitted list and must be started again with BeginUploadBatch() to be reused.
+*/
+uint64_t ExecuteUploadBatch(UploadBatch& _batch)
 {
-	const UINT64 size = static_cast<UINT64>(_width * _height * _channelNum);
+	_batch.cmd->Close();
 
-	// Create temp upload buffer.
-	MComPtr<ID3D12Resource> stagingBuffer;
+	ID3D12CommandList* cmdListsArr[] = { _batch.cmd.Get() };
+	copyQueue->ExecuteCommandLists(1, cmdListsArr);
 
-	const D3D12_HEAP_PROPERTIES heap{
-		.Type = D3D12_HEAP_TYPE_UPLOAD,
-	};
+	_batch.fenceValue = ++uploadFenceValue;
+	copyQueue->Signal(uploadFence.Get(), _batch.fenceValue);
 
-	const D3D12_RESOURCE_DESC desc{
-		.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
-		.Alignment = 0,
-		.Width = size,
-		.Height = 1,
-		.DepthOrArraySize = 1,
-		.MipLevels = 1,
-		.Format = DXGI_FORMAT_UNKNOWN,
-		.SampleDesc = {.Count = 1, .Quality = 0 },
-		.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
-		.Flags = D3D12_RESOURCE_FLAG_NONE,
-	};
+	// Ring memory used by this batch is released once fenceValue is reached.
+	uploadRing.inFlight.push_back(UploadRing::InFlightRange{ .fenceValue = _batch.fenceValue, .head = uploadRing.head });
 
-	const HRESULT hrStagBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COPY_SOURCE, nullptr, IID_PPV_ARGS(&stagingBuffer));
-	if (FAILED(hrStagBufferCreated))
+	const uint64_t fenceValue = _batch.fenceValue;
+
+	submittedUploadBatches.push_back(std::move(_batch));
+	_batch = UploadBatch{};
+
+	return fenceValue;
+}
+
+/**
+* Recycle the batches (allocators, staging memory) already executed by the copy queue.
+* Non-blocking: called once per frame.
+*/
+void ReleaseCompletedUploadBatches()
+{
+	const uint64_t completedValue = uploadFence->GetCompletedValue();
+
+	while (!submittedUploadBatches.empty() && submittedUploadBatches.front().fenceValue <= completedValue)
 	{
-		SA_LOG(L"Create Staging Buffer failed!", Error, DX12);
-		return false;
+		UploadBatch& batch = submittedUploadBatches.front();
+		batch.stagingBuffers.clear();
+
+		freeUploadBatches.push_back(std::move(batch));
+		submittedUploadBatches.pop_front();
 	}
 
+	RetireUploadRing();
+}
 
-	// Memory mapping and Upload (CPU to GPU transfer).
-	const D3D12_RANGE range{ .Begin = 0, .End = 0 };
-	void* data = nullptr;
+/**
+* CPU wait for the copy queue to reach _fenceValue.
+* Only required to recycle upload memory: rendering should use GraphicsQueueWaitUpload() instead.
+*/
+void WaitUploadFence(uint64_t _fenceValue)
+{
+	if (uploadFence->GetCompletedValue() >= _fenceValue)
+		return;
 
-	stagingBuffer->Map(0, &range, reinterpret_cast<void**>(&data));
-	std::memcpy(data, _data, size);
-	stagingBuffer->Unmap(0, nullptr);
-
-
-	// Copy Buffer to texture
-	/**
-	* Copy Buffer to Texture
-	* Mipmaps are not handled here. For mipmapping:
-	*   - Generate Mipmaps
-	*   - Record one copy for each mips using src.Offset and dst.SubresourceIndex
-	*/
-	const D3D12_TEXTURE_COPY_LOCATION src{
-		.pResource = stagingBuffer.Get(),
-		.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT,
-		.PlacedFootprint = D3D12_PLACED_SUBRESOURCE_FOOTPRINT{
-			.Offset = 0, // currMipLevel
-			.Footprint = D3D12_SUBRESOURCE_FOOTPRINT{
-				.Format = _format,
-				.Width = static_cast<UINT>(_width),
-				.Height = static_cast<UINT>(_height),
-				.Depth = 1,
-				.RowPitch = static_cast<UINT>(_width * _channelNum),
-			}
-		}
-	};
+	uploadFence->SetEventOnCompletion(_fenceValue, uploadFenceEvent);
+	WaitForSingleObjectEx(uploadFenceEvent, INFINITE, false);
+}
 
-	const D3D12_TEXTURE_COPY_LOCATION dst{
-		.pResource = _gpuTexture.Get(),
-		.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX,
-		.SubresourceIndex = 0 // currMipLevel
-	};
+/**
+* GPU-side wait: make the graphics queue wait for the copy queue before the first use of resources uploaded with _fenceValue.
+* The wait is only scheduled once: resources already waited on are free to use.
+* Must be called before executing the command lists using the resources.
+*/
+void GraphicsQueueWaitUpload(uint64_t _fenceValue)
+{
+	if (_fenceValue <= graphicsQueueUploadFenceValue)
+		return;
 
-	cmdLists[0]->CopyTextureRegion(&dst, 0u, 0u, 0u, &src, nullptr);
+	graphicsQueue->Wait(uploadFence.Get(), _fenceValue);
+	graphicsQueueUploadFenceValue = _fenceValue;
+}
 
 
-	// Resource transition to final state.
-	const D3D12_RESOURCE_BARRIER barrier{
-		.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-		.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-		.Transition = {
-			.pResource = _gpuTexture.Get(),
-			.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
-			.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST,
-			.StateAfter = _stateAfter,
-		},
-	};
+/**
+* Screen-space LOD selection: projected error (pixels) = error * screenHeight / (2 * tan(fov / 2) * distance).
+* Distance to the submesh bounding sphere, clamped to cameraNear (camera inside the bounds).
+* _cameraPosition is in mesh space.
+* Return nullptr for LOD 0 (the submesh itself).
+*/
+const MeshLOD* SelectLOD(const Submesh& _submesh, const std::vector<MeshLOD>& _lods, const Float3& _cameraPosition)
+{
+	const BoundingSphere& sphere = _submesh.sphere;
 
-	cmdLists[0]->ResourceBarrier(1, &barrier);
+	const Float3 toCenter{ sphere.center.x - _cameraPosition.x, sphere.center.y - _cameraPosition.y, sphere.center.z - _cameraPosition.z };
 
-	cmdLists[0]->Close();
+	const float distance = (std::max)(std::sqrt(toCenter.x * toCenter.x + toCenter.y * toCenter.y + toCenter.z * toCenter.z) - sphere.radius, cameraNear);
 
-	/**
-	* Instant command submit execution (easy implementation)
-	* Better code would parallelize resources loading in staging buffer and submit only once at the end to execute all GPU copies.
-	*/
+	// Pixels per world unit at distance 1.
+	const float projectionScale = float(windowSize.y) / (2.0f * std::tan(0.5f * cameraFOV * SA::Maths::DegToRad<float>));
 
-	ID3D12CommandList* cmdListsArr[] = { cmdLists[0].Get() };
-	graphicsQueue->ExecuteCommandLists(1, cmdListsArr);
+	const MeshLOD* selected = nullptr;
 
-	WaitDeviceIdle();
+	// Levels are sorted by increasing error.
+	for (uint32_t i = _submesh.lodOffset; i < _submesh.lodOffset + _submesh.lodNum; ++i)
+	{
+		if (_lods[i].error * projectionScale / distance > lodMaxPixelError)
+			break;
 
-	cmdAllocs[0]->Reset();
-	cmdLists[0]->Reset(cmdAllocs[0].Get(), nullptr);
+		selected = &_lods[i];
+	}
 
-	return true;
+	return selected;
 }
 
 
-int main()
+int main(int argc, char** argv)
 {
 	// Initialization
 	{
@@ -637,7 +1681,7 @@ int main()
 
 				// Queue
 				{
-					// This renderer example only use 1 graphics queue.
+					// This renderer example uses 1 graphics queue and 1 copy queue for uploads.
 
 					// GFX
 					{
@@ -657,6 +1701,21 @@ int main()
 							return EXIT_FAILURE;
 						}
 					}
+
+					// Copy
+					{
+						const D3D12_COMMAND_QUEUE_DESC desc{
+							.Type = D3D12_COMMAND_LIST_TYPE_COPY,
+							.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE,
+						};
+
+						const HRESULT hrCopyCmdQueueCreated = device->CreateCommandQueue(&desc, IID_PPV_ARGS(&copyQueue));
+						if (FAILED(hrCopyCmdQueueCreated))
+						{
+							SA_LOG(L"Create Copy Queue failed!", Error, DX12);
+							return EXIT_FAILURE;
+						}
+					}
 				}
 
 
@@ -675,6 +1734,21 @@ int main()
 						SA_LOG(L"Create Device Fence failed!", Error, DX12);
 						return EXIT_FAILURE;
 					}
+
+
+					uploadFenceEvent = CreateEvent(nullptr, false, false, nullptr);
+					if (!uploadFenceEvent)
+					{
+						SA_LOG(L"Create Upload Fence Event failed!", Error, DX12);
+						return EXIT_FAILURE;
+					}
+
+					const HRESULT hrUploadFenceCreated = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&uploadFence));
+					if (FAILED(hrUploadFenceCreated))
+					{
+						SA_LOG(L"Create Upload Fence failed!", Error, DX12);
+						return EXIT_FAILURE;
+					}
 				}
 			}
 
@@ -764,6 +1838,49 @@ int main()
 			}
 
 
+
+			// Upload Ring
+			{
+				const D3D12_HEAP_PROPERTIES heap{
+					.Type = D3D12_HEAP_TYPE_UPLOAD,
+				};
+
+				const D3D12_RESOURCE_DESC desc{
+					.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+					.Alignment = 0,
+					.Width = uploadRingCapacity,
+					.Height = 1,
+					.DepthOrArraySize = 1,
+					.MipLevels = 1,
+					.Format = DXGI_FORMAT_UNKNOWN,
+					.SampleDesc = {.Count = 1, .Quality = 0 },
+					.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+					.Flags = D3D12_RESOURCE_FLAG_NONE,
+				};
+
+				const HRESULT hrRingCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&uploadRing.buffer));
+				if (FAILED(hrRingCreated))
+				{
+					SA_LOG(L"Create Upload Ring failed!", Error, DX12);
+					return EXIT_FAILURE;
+				}
+
+				/**
+				* Persistent mapping: upload heaps can stay mapped for the whole resource lifetime.
+				* Empty read range: the CPU never reads this memory.
+				*/
+				const D3D12_RANGE range{ .Begin = 0, .End = 0 };
+				const HRESULT hrRingMapped = uploadRing.buffer->Map(0, &range, reinterpret_cast<void**>(&uploadRing.mappedData));
+				if (FAILED(hrRingMapped))
+				{
+					SA_LOG(L"Map Upload Ring failed!", Error, DX12);
+					return EXIT_FAILURE;
+				}
+
+				uploadRing.capacity = uploadRingCapacity;
+			}
+
+
 			// Scene Resources
 			{
 				// Color RT View Heap
@@ -942,7 +2059,7 @@ int main()
 								.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC,
 								.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
 							},
-							// Metallic
+							// Metallic (ORM with bORMTexture)
 							{
 								.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
 								.NumDescriptors = 1,
@@ -951,7 +2068,7 @@ int main()
 								.Flags = D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC,
 								.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
 							},
-							// Roughness
+							// Roughness (unused with bORMTexture: last range)
 							{
 								.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV,
 								.NumDescriptors = 1,
@@ -961,6 +2078,7 @@ int main()
 								.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND
 							},
 						};
+						constexpr UINT pbrTextureRangeNum = bORMTexture ? _countof(pbrTextureRange) - 1 : _countof(pbrTextureRange);
 
 						const D3D12_ROOT_PARAMETER1 params[]{
 							// Camera Constant buffer
@@ -1000,7 +2118,7 @@ int main()
 							{
 								.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE,
 								.DescriptorTable {
-									.NumDescriptorRanges = _countof(pbrTextureRange),
+									.NumDescriptorRanges = pbrTextureRangeNum,
 									.pDescriptorRanges = pbrTextureRange
 								},
 								.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL,
@@ -1062,7 +2180,13 @@ int main()
 					{
 						MComPtr<ID3DBlob> errors;
 
-						const HRESULT hrCompileShader = D3DCompileFromFile(L"Resources/Shaders/LitShader.hlsl", nullptr, nullptr, "mainVS", "vs_5_0", shaderCompileFlags, 0, &litVertexShader, &errors);
+						// Vulkan equivalent: specialization constants or #define injected by the GLSL/HLSL to SPIR-V compiler.
+						const D3D_SHADER_MACRO macros[]{
+							{ "QUANTIZED_VERTEX", bQuantizedVertexFormat ? "1" : "0" },
+							{ nullptr, nullptr },
+						};
+
+						const HRESULT hrCompileShader = D3DCompileFromFile(L"Resources/Shaders/LitShader.hlsl", macros, nullptr, "mainVS", "vs_5_0", shaderCompileFlags, 0, &litVertexShader, &errors);
 
 						if (FAILED(hrCompileShader))
 						{
@@ -1077,7 +2201,13 @@ int main()
 					{
 						MComPtr<ID3DBlob> errors;
 
-						const HRESULT hrCompileShader = D3DCompileFromFile(L"Resources/Shaders/LitShader.hlsl", nullptr, nullptr, "mainPS", "ps_5_0", shaderCompileFlags, 0, &litPixelShader, &errors);
+						const D3D_SHADER_MACRO macros[]{
+							{ "ORM_TEXTURE", bORMTexture ? "1" : "0" },
+							{ "MATERIAL_TEXTURE_ARRAY", bMaterialTextureArrays ? "1" : "0" },
+							{ nullptr, nullptr },
+						};
+
+						const HRESULT hrCompileShader = D3DCompileFromFile(L"Resources/Shaders/LitShader.hlsl", macros, nullptr, "mainPS", "ps_5_0", shaderCompileFlags, 0, &litPixelShader, &errors);
 
 						if (FAILED(hrCompileShader))
 						{
@@ -1166,7 +2296,7 @@ int main()
 							{
 								.SemanticName = "POSITION",
 								.SemanticIndex = 0,
-								.Format = DXGI_FORMAT_R32G32B32_FLOAT,
+								.Format = bQuantizedVertexFormat ? DXGI_FORMAT_R16G16B16A16_UNORM : DXGI_FORMAT_R32G32B32_FLOAT,
 								.InputSlot = 0,
 								.AlignedByteOffset = 0,
 								.InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
@@ -1175,7 +2305,7 @@ int main()
 							{
 								.SemanticName = "NORMAL",
 								.SemanticIndex = 0,
-								.Format = DXGI_FORMAT_R32G32B32_FLOAT,
+								.Format = bQuantizedVertexFormat ? DXGI_FORMAT_R16G16_SNORM : DXGI_FORMAT_R32G32B32_FLOAT,
 								.InputSlot = 1,
 								.AlignedByteOffset = 0,
 								.InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
@@ -1184,7 +2314,7 @@ int main()
 							{
 								.SemanticName = "TANGENT",
 								.SemanticIndex = 0,
-								.Format = DXGI_FORMAT_R32G32B32_FLOAT,
+								.Format = bQuantizedVertexFormat ? DXGI_FORMAT_R16G16_SNORM : DXGI_FORMAT_R32G32B32A32_FLOAT,
 								.InputSlot = 2,
 								.AlignedByteOffset = 0,
 								.InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
@@ -1193,7 +2323,7 @@ int main()
 							{
 								.SemanticName = "TEXCOORD",
 								.SemanticIndex = 0,
-								.Format = DXGI_FORMAT_R32G32_FLOAT,
+								.Format = bQuantizedVertexFormat ? DXGI_FORMAT_R16G16_FLOAT : DXGI_FORMAT_R32G32_FLOAT,
 								.InputSlot = 3,
 								.AlignedByteOffset = 0,
 								.InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA,
@@ -1261,163 +2391,118 @@ int main()
 			}
 
 
-			// Resources
-			{
-				cmdLists[0]->Reset(cmdAllocs[0].Get(), nullptr);
-
-				Assimp::Importer importer;
-
-				// Meshes
-				{
-					// Sphere
-					{
-						const char* path = "Resources/Models/Shapes/sphere.obj";
-						const aiScene* scene = importer.ReadFile(path, aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded);
-						if (!scene)
-						{
-							SA_LOG(L"Assimp loading failed!", Error, Assimp, path);
-							return EXIT_FAILURE;
-						}
-
-						const aiMesh* inMesh = scene->mMeshes[0];
-
-						// Position
-						{
-							/**
-							* VkMemoryPropertyFlagBits -> D3D12_HEAP_PROPERTIES.Type
-							* Defines if a buffer is GPU only, CPU-GPU, ...
-							* In Vulkan, a buffer can be GPU only or CPU-GPU for data transfer (read and write).
-							* In DirectX12, a buffer is either GPU only, 'Upload' for data transfer from CPU to GPU, or 'Readback' for data transfer from GPU to CPU.
-							* 'Upload' and 'Readback' at the same time is NOT possible.
-							*/
-							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT, // Type Default is GPU only.
-							};
-
-							const D3D12_RESOURCE_DESC desc{
-								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
-								.Alignment = 0,
-								.Width = sizeof(SA::Vec3f) * inMesh->mNumVertices,
-								.Height = 1,
-								.DepthOrArraySize = 1,
-								.MipLevels = 1,
-								.Format = DXGI_FORMAT_UNKNOWN,
-								.SampleDesc = {.Count = 1, .Quality = 0 },
-								.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
-								.Flags = D3D12_RESOURCE_FLAG_NONE,
-							};
-
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[0]));
-							if (FAILED(hrBufferCreated))
-							{
-								SA_LOG(L"Create Sphere Vertex Position Buffer failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
+			// Resources
+			{
+				/**
+				* Record all the resource copies in a single batch on the copy queue.
+				* The batch is submitted only once at the end of resources loading.
+				*/
+				UploadBatch uploadBatch;
+				if (!BeginUploadBatch(uploadBatch))
+					return EXIT_FAILURE;
 
-							sphereVertexBufferViews[0] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[0]->GetGPUVirtualAddress(),
-								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec3f),
-							};
+				// Meshes
+				{
+					// Sphere
+					{
+						/**
+						* Cooked mesh (see MeshCooker): GPU-ready streams, memory-mapped and copied straight into staging memory.
+						* glTF (.glb): accessors are copied (or converted) straight from the mapped file into staging memory.
+						* The file mapping must outlive the SubmitBufferToGPU() calls only.
+						*/
+						const char* path = argc > 1 ? argv[1] : defaultSphereMeshPath;
+						const std::string_view pathView = path;
 
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[0], desc.Width, inMesh->mVertices, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
-							if (!bSubmitSuccess)
-							{
-								SA_LOG(L"Sphere Vertex Position Buffer submit failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
-						}
+						bSphereRightHanded = pathView.size() >= 4 && pathView.substr(pathView.size() - 4) == ".glb";
 
-						// Normal
-						{
-							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
-							};
+						MappedFile meshFile;
+						MeshFileView inMesh;
+						GlbFileView inGlb;
 
-							const D3D12_RESOURCE_DESC desc{
-								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
-								.Alignment = 0,
-								.Width = sizeof(SA::Vec3f) * inMesh->mNumVertices,
-								.Height = 1,
-								.DepthOrArraySize = 1,
-								.MipLevels = 1,
-								.Format = DXGI_FORMAT_UNKNOWN,
-								.SampleDesc = {.Count = 1, .Quality = 0 },
-								.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
-								.Flags = D3D12_RESOURCE_FLAG_NONE,
-							};
+						if (!meshFile.Open(path))
+						{
+							SA_LOG(L"Sphere mesh file not found! (re-run the CookMeshes target)", Error, DX12, path);
+							return EXIT_FAILURE;
+						}
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[1]));
-							if (FAILED(hrBufferCreated))
+						if (bSphereRightHanded)
+						{
+							if (!ParseGlb(meshFile.GetData(), meshFile.GetSize(), inGlb))
 							{
-								SA_LOG(L"Create Sphere Vertex Normal Buffer failed!", Error, DX12);
+								SA_LOG(L"glTF mesh loading failed!", Error, DX12, path);
 								return EXIT_FAILURE;
 							}
 
-							sphereVertexBufferViews[1] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[1]->GetGPUVirtualAddress(),
-								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec3f),
-							};
+							// Streamed as-is: no tangent generation at runtime.
+							for (const GlbPrimitiveView& primitive : inGlb.primitives)
+							{
+								if (!primitive.normals.data || !primitive.tangents.data || !primitive.uvs.data)
+								{
+									SA_LOG(L"glTF mesh without normals, tangents or UVs: cook it with MeshCooker (generates tangents).", Error, DX12, path);
+									return EXIT_FAILURE;
+								}
+							}
 
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[1], desc.Width, inMesh->mNormals, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
-							if (!bSubmitSuccess)
+							sphereBounds = inGlb.bounds;
+						}
+						else
+						{
+							if (!ParseMeshFile(meshFile.GetData(), meshFile.GetSize(), inMesh))
 							{
-								SA_LOG(L"Sphere Vertex Normal Buffer submit failed!", Error, DX12);
+								SA_LOG(L"Cooked mesh loading failed! (re-run the CookMeshes target)", Error, DX12, path);
 								return EXIT_FAILURE;
 							}
+
+							sphereBounds = inMesh.bounds;
 						}
 
-						// Tangent
-						{
-							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
-							};
+						// Vertex streams, in Lit input layout slot order.
+						constexpr std::array<VertexSemantic, 4> streamSemantics{
+							VertexSemantic::Position,
+							VertexSemantic::Normal,
+							VertexSemantic::Tangent,
+							VertexSemantic::UV,
+						};
 
-							const D3D12_RESOURCE_DESC desc{
-								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
-								.Alignment = 0,
-								.Width = sizeof(SA::Vec3f) * inMesh->mNumVertices,
-								.Height = 1,
-								.DepthOrArraySize = 1,
-								.MipLevels = 1,
-								.Format = DXGI_FORMAT_UNKNOWN,
-								.SampleDesc = {.Count = 1, .Quality = 0 },
-								.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
-								.Flags = D3D12_RESOURCE_FLAG_NONE,
-							};
+						// Formats expected by the Lit input layout.
+						constexpr std::array<VertexFormat, 4> streamFormats = bQuantizedVertexFormat ?
+							std::array<VertexFormat, 4>{ VertexFormat::UNorm16x4, VertexFormat::OctahedralSNorm16x2, VertexFormat::OctahedralSNorm16x2, VertexFormat::Half2 } :
+							std::array<VertexFormat, 4>{ VertexFormat::Float3, VertexFormat::Float3, VertexFormat::Float4, VertexFormat::Float2 };
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[2]));
-							if (FAILED(hrBufferCreated))
+						for (size_t i = 0; i < streamSemantics.size(); ++i)
+						{
+							const MeshStreamView* stream = bSphereRightHanded ? nullptr : inMesh.FindStream(streamSemantics[i]);
+							if (!bSphereRightHanded && !stream)
 							{
-								SA_LOG(L"Create Sphere Vertex Tangent Buffer failed!", Error, DX12);
+								SA_LOG(L"Sphere mesh vertex stream missing!", Error, DX12, path);
 								return EXIT_FAILURE;
 							}
 
-							sphereVertexBufferViews[2] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[2]->GetGPUVirtualAddress(),
-								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec3f),
-							};
-
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[2], desc.Width, inMesh->mTangents, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
-							if (!bSubmitSuccess)
+							if (stream && stream->format != streamFormats[i])
 							{
-								SA_LOG(L"Sphere Vertex Tangent Buffer submit failed!", Error, DX12);
+								SA_LOG(L"Sphere mesh vertex format doesn't match the Lit input layout (check MeshCooker --vertex-format).", Error, DX12, path);
 								return EXIT_FAILURE;
 							}
-						}
 
-						// UV
-						{
+							// glTF streams are written in the input layout format.
+							const uint32_t stride = stream ? stream->stride : GetVertexFormatSize(streamFormats[i]);
+							const uint64_t size = stream ? stream->size : static_cast<uint64_t>(inGlb.vertexNum) * stride;
+
+							/**
+							* VkMemoryPropertyFlagBits -> D3D12_HEAP_PROPERTIES.Type
+							* Defines if a buffer is GPU only, CPU-GPU, ...
+							* In Vulkan, a buffer can be GPU only or CPU-GPU for data transfer (read and write).
+							* In DirectX12, a buffer is either GPU only, 'Upload' for data transfer from CPU to GPU, or 'Readback' for data transfer from GPU to CPU.
+							* 'Upload' and 'Readback' at the same time is NOT possible.
+							*/
 							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
+								.Type = D3D12_HEAP_TYPE_DEFAULT, // Type Default is GPU only.
 							};
 
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(SA::Vec2f) * inMesh->mNumVertices,
+								.Width = size,
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -1427,31 +2512,34 @@ int main()
 								.Flags = D3D12_RESOURCE_FLAG_NONE,
 							};
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[3]));
+							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&sphereVertexBuffers[i]));
 							if (FAILED(hrBufferCreated))
 							{
-								SA_LOG(L"Create Sphere Vertex UV Buffer failed!", Error, DX12);
+								SA_LOG(L"Create Sphere Vertex Buffer failed!", Error, DX12);
 								return EXIT_FAILURE;
 							}
 
-							sphereVertexBufferViews[3] = D3D12_VERTEX_BUFFER_VIEW{
-								.BufferLocation = sphereVertexBuffers[3]->GetGPUVirtualAddress(),
+							sphereVertexBufferViews[i] = D3D12_VERTEX_BUFFER_VIEW{
+								.BufferLocation = sphereVertexBuffers[i]->GetGPUVirtualAddress(),
 								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.StrideInBytes = sizeof(SA::Vec2f),
+								.StrideInBytes = stride,
 							};
 
-							std::vector<SA::Vec2f> uvs;
-							uvs.reserve(inMesh->mNumVertices);
-
-							for (uint32_t i = 0; i < inMesh->mNumVertices; ++i)
-							{
-								uvs.push_back(SA::Vec2f{ inMesh->mTextureCoords[0][i].x, inMesh->mTextureCoords[0][i].y });
-							}
+							const bool bSubmitSuccess = stream ?
+								SubmitBufferToGPUInPlace(uploadBatch, sphereVertexBuffers[i], desc.Width, [&](void* _staging)
+								{
+									// Compressed streams are decoded in parallel straight into staging memory.
+									return ReadMeshStream(inMesh, *stream, _staging);
+								}) :
+								SubmitBufferToGPUInPlace(uploadBatch, sphereVertexBuffers[i], desc.Width, [&](void* _staging)
+								{
+									// Missing attributes (tangents) are not generated at runtime: cook the mesh instead.
+									return WriteGlbVertexStream(inGlb, streamSemantics[i], streamFormats[i], sphereBounds, _staging);
+								});
 
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereVertexBuffers[3], desc.Width, uvs.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
 							if (!bSubmitSuccess)
 							{
-								SA_LOG(L"Sphere Vertex UV Buffer submit failed!", Error, DX12);
+								SA_LOG(L"Sphere Vertex Buffer submit failed!", Error, DX12);
 								return EXIT_FAILURE;
 							}
 						}
@@ -1465,7 +2553,7 @@ int main()
 							const D3D12_RESOURCE_DESC desc{
 								.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
 								.Alignment = 0,
-								.Width = sizeof(uint16_t) * inMesh->mNumFaces * 3,
+								.Width = bSphereRightHanded ? static_cast<uint64_t>(inGlb.indexNum) * GetIndexFormatSize(inGlb.indexFormat) : inMesh.indexSize,
 								.Height = 1,
 								.DepthOrArraySize = 1,
 								.MipLevels = 1,
@@ -1485,22 +2573,23 @@ int main()
 							sphereIndexBufferView = D3D12_INDEX_BUFFER_VIEW{
 								.BufferLocation = sphereIndexBuffer->GetGPUVirtualAddress(),
 								.SizeInBytes = static_cast<UINT>(desc.Width),
-								.Format = DXGI_FORMAT_R16_UINT, // This model's indices are lower than 65535.
+								.Format = (bSphereRightHanded ? inGlb.indexFormat : inMesh.indexFormat) == IndexFormat::UInt16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT,
 							};
 
-
-							std::vector<uint16_t> indices;
-							indices.resize(inMesh->mNumFaces * 3);
-							sphereIndexCount = inMesh->mNumFaces * 3;
-
-							for (unsigned int i = 0; i < inMesh->mNumFaces; ++i)
-							{
-								indices[i * 3] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[0]);
-								indices[i * 3 + 1] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[1]);
-								indices[i * 3 + 2] = static_cast<uint16_t>(inMesh->mFaces[i].mIndices[2]);
-							}
-
-							const bool bSubmitSuccess = SubmitBufferToGPU(sphereIndexBuffer, desc.Width, indices.data(), D3D12_RESOURCE_STATE_INDEX_BUFFER);
+							sphereSubmeshes = bSphereRightHanded ? inGlb.submeshes : inMesh.submeshes;
+							sphereMeshlets = inMesh.meshlets;
+							sphereLODs = inMesh.lods;
+
+							const bool bSubmitSuccess = bSphereRightHanded ?
+								SubmitBufferToGPUInPlace(uploadBatch, sphereIndexBuffer, desc.Width, [&](void* _staging)
+								{
+									WriteGlbIndices(inGlb, _staging);
+									return true;
+								}) :
+								SubmitBufferToGPUInPlace(uploadBatch, sphereIndexBuffer, desc.Width, [&](void* _staging)
+								{
+									return ReadMeshIndices(inMesh, _staging);
+								});
 							if (!bSubmitSuccess)
 							{
 								SA_LOG(L"Sphere Index Buffer submit failed!", Error, DX12);
@@ -1513,259 +2602,111 @@ int main()
 
 				// Textures
 				{
+					// Used by the .png fallback only: cooked textures are already flipped (see TextureCooker).
 					stbi_set_flip_vertically_on_load(true);
 
 					// RustedIron2 PBR
 					{
-						const UINT srvOffset = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-						D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = srvHeap->GetCPUDescriptorHandleForHeapStart();
-						cpuHandle.ptr += srvOffset; // Add offset because first slot it for PointLightsBuffer.
+						// No occlusion map: constant 1 (no occlusion).
+						const TexturePackDesc ormPack{
+							.sourcePaths{ nullptr, "Resources/Textures/RustedIron2/rustediron2_roughness", "Resources/Textures/RustedIron2/rustediron2_metallic" },
+						};
 
-						// Albedo
+						// bMaterialTextureArrays: the descs are array slices, textures are created by CreateTextureArraysFromFiles().
+						const auto outTexture = [](uint32_t _index) -> MComPtr<ID3D12Resource>*
 						{
-							const char* path = "Resources/Textures/RustedIron2/rustediron2_basecolor.png";
-
-							int width, height, channels;
-							uint8_t* inData = stbi_load(path, &width, &height, &channels, 4);
-							if (!inData)
-							{
-								SA_LOG(L"STBI Texture Loading failed", Error, STB, path);
-								return EXIT_FAILURE;
-							}
-
-							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
-							};
-
-							const D3D12_RESOURCE_DESC desc{
-								.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-								.Alignment = 0,
-								.Width = static_cast<uint32_t>(width),
-								.Height = static_cast<uint32_t>(height),
-								.DepthOrArraySize = 1,
-								.MipLevels = 1,
-								.Format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
-								.SampleDesc = {.Count = 1, .Quality = 0 },
-								.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
-								.Flags = D3D12_RESOURCE_FLAG_NONE,
-							};
-
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&rustedIron2AlbedoTexture));
-							if (FAILED(hrBufferCreated))
-							{
-								SA_LOG(L"Create RustedIron2 Albedo Texture failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
+							return bMaterialTextureArrays ? nullptr : &rustedIron2Textures[_index];
+						};
 
-							const bool bSubmitSuccess = SubmitTextureToGPU(rustedIron2AlbedoTexture, width, height, channels, DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, inData, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-							if (!bSubmitSuccess)
-							{
-								SA_LOG(L"RustedIron2 Albedo Texture submit failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
+						const TextureFileDesc textureDescs[]{
+							// BC7: full RGBA quality at 1 byte per texel.
+							{ "Resources/Textures/RustedIron2/rustediron2_basecolor", ImageFormat::RGBA8_SRGB, BCFormat::BC7, outTexture(0) },
 
-							stbi_image_free(inData);
+							// BC5: only XY are stored, Z is rebuilt in shader.
+							{ "Resources/Textures/RustedIron2/rustediron2_normal", ImageFormat::RGBA8, BCFormat::BC5, outTexture(1) },
 
+							/**
+							* bORMTexture: BC7 ORM, same memory as the 2 BC4 textures (BC1 would halve it, but its RGB endpoints don't fit uncorrelated channels).
+							* Otherwise BC4: single channel.
+							*/
+							bORMTexture ?
+								TextureFileDesc{ "Resources/Textures/RustedIron2/rustediron2_orm", ImageFormat::RGBA8, BCFormat::BC7, outTexture(2), &ormPack } :
+								TextureFileDesc{ "Resources/Textures/RustedIron2/rustediron2_metallic", ImageFormat::R8, BCFormat::BC4, outTexture(2) },
+							{ "Resources/Textures/RustedIron2/rustediron2_roughness", ImageFormat::R8, BCFormat::BC4, outTexture(3) },
+						};
 
-							// Create View
-							{
-								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
-									.Format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
-									.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
-									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
-									.Texture2D{
-										.MipLevels = 1,
-									},
-								};
+						// bORMTexture: roughness is packed in the ORM texture, last texture not loaded.
+						constexpr uint32_t textureNum = bORMTexture ? _countof(textureDescs) - 1 : _countof(textureDescs);
 
-								device->CreateShaderResourceView(rustedIron2AlbedoTexture.Get(), &viewDesc, cpuHandle);
-								cpuHandle.ptr += srvOffset;
-							}
-						}
+						bool bLoadSuccess = false;
 
-						// Normal Map
+						if constexpr (bMaterialTextureArrays)
 						{
-							const char* path = "Resources/Textures/RustedIron2/rustediron2_normal.png";
-
-							int width, height, channels;
-							uint8_t* inData = stbi_load(path, &width, &height, &channels, 4);
-							if (!inData)
-							{
-								SA_LOG(L"STBI Texture Loading failed", Error, STB, path);
-								return EXIT_FAILURE;
-							}
-
-							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
-							};
-
-							const D3D12_RESOURCE_DESC desc{
-								.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-								.Alignment = 0,
-								.Width = static_cast<uint32_t>(width),
-								.Height = static_cast<uint32_t>(height),
-								.DepthOrArraySize = 1,
-								.MipLevels = 1,
-								.Format = DXGI_FORMAT_R8G8B8A8_UNORM,
-								.SampleDesc = {.Count = 1, .Quality = 0 },
-								.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
-								.Flags = D3D12_RESOURCE_FLAG_NONE,
+							// Material texture sets (albedo, normal, metallic / ORM, roughness): slice i of every array is material i.
+							const TextureFileDesc* const materials[]{
+								textureDescs, // rustedIron2MaterialIndex
 							};
+							constexpr uint32_t materialNum = _countof(materials);
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&rustedIron2NormalTexture));
-							if (FAILED(hrBufferCreated))
-							{
-								SA_LOG(L"Create RustedIron2 Normal Texture failed!", Error, DX12);
-								return 1;
-							}
+							// Gather the slices of each array.
+							std::vector<TextureFileDesc> sliceDescs(textureNum * materialNum);
+							TextureArrayDesc arrayDescs[textureNum];
 
-							const bool bSubmitSuccess = SubmitTextureToGPU(rustedIron2NormalTexture, width, height, 4, DXGI_FORMAT_R8G8B8A8_UNORM, inData, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-							if (!bSubmitSuccess)
+							for (uint32_t i = 0; i < textureNum; ++i)
 							{
-								SA_LOG(L"RustedIron2 Normal Texture submit failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
+								for (uint32_t material = 0; material < materialNum; ++material)
+									sliceDescs[i * materialNum + material] = materials[material][i];
 
-							stbi_image_free(inData);
-
-
-							// Create View
-							{
-								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
-									.Format = DXGI_FORMAT_R8G8B8A8_UNORM,
-									.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
-									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
-									.Texture2D{
-										.MipLevels = 1,
-									},
+								arrayDescs[i] = TextureArrayDesc{
+									.slices = &sliceDescs[i * materialNum],
+									.sliceNum = materialNum,
+									.outTexture = &materialTextureArrays[i],
 								};
-								device->CreateShaderResourceView(rustedIron2NormalTexture.Get(), &viewDesc, cpuHandle);
-								cpuHandle.ptr += srvOffset;
-							}
-						}
-
-						// Metallic
-						{
-							const char* path = "Resources/Textures/RustedIron2/rustediron2_metallic.png";
-
-							int width, height, channels;
-							uint8_t* inData = stbi_load(path, &width, &height, &channels, 1);
-							if (!inData)
-							{
-								SA_LOG(L"STBI Texture Loading failed", Error, STB, path);
-								return EXIT_FAILURE;
-							}
-
-							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
-							};
-
-							const D3D12_RESOURCE_DESC desc{
-								.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-								.Alignment = 0,
-								.Width = static_cast<uint32_t>(width),
-								.Height = static_cast<uint32_t>(height),
-								.DepthOrArraySize = 1,
-								.MipLevels = 1,
-								.Format = DXGI_FORMAT_R8_UNORM,
-								.SampleDesc = {.Count = 1, .Quality = 0 },
-								.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
-								.Flags = D3D12_RESOURCE_FLAG_NONE,
-							};
-
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&rustedIron2MetallicTexture));
-							if (FAILED(hrBufferCreated))
-							{
-								SA_LOG(L"Create RustedIron2 Metallic Texture failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
-
-							const bool bSubmitSuccess = SubmitTextureToGPU(rustedIron2MetallicTexture, width, height, channels, DXGI_FORMAT_R8_UNORM, inData, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-							if (!bSubmitSuccess)
-							{
-								SA_LOG(L"RustedIron2 Metallic Texture submit failed!", Error, DX12);
-								return EXIT_FAILURE;
 							}
 
-							stbi_image_free(inData);
-
-
-							// Create View
-							{
-								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
-									.Format = DXGI_FORMAT_R8_UNORM,
-									.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
-									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
-									.Texture2D{
-										.MipLevels = 1,
-									},
-								};
-
-								device->CreateShaderResourceView(rustedIron2MetallicTexture.Get(), &viewDesc, cpuHandle);
-								cpuHandle.ptr += srvOffset;
-							}
+							bLoadSuccess = CreateTextureArraysFromFiles(uploadBatch, arrayDescs, textureNum);
 						}
+						else
+							bLoadSuccess = CreateTexturesFromFiles(uploadBatch, textureDescs, textureNum);
 
-						// Roughness
+						if (!bLoadSuccess)
 						{
-							const char* path = "Resources/Textures/RustedIron2/rustediron2_roughness.png";
+							SA_LOG(L"Create RustedIron2 Textures failed!", Error, DX12);
+							return EXIT_FAILURE;
+						}
 
-							int width, height, channels;
-							uint8_t* inData = stbi_load(path, &width, &height, &channels, 1);
-							if (!inData)
-							{
-								SA_LOG(L"STBI Texture Loading failed", Error, STB, path);
-								return EXIT_FAILURE;
-							}
 
-							const D3D12_HEAP_PROPERTIES heap{
-								.Type = D3D12_HEAP_TYPE_DEFAULT,
-							};
+						// Create Views (albedo, normal, metallic / ORM, roughness: pbrTextureRange order).
+						const UINT srvOffset = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+						D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = srvHeap->GetCPUDescriptorHandleForHeapStart();
+						cpuHandle.ptr += srvOffset; // Add offset because first slot it for PointLightsBuffer.
 
-							const D3D12_RESOURCE_DESC desc{
-								.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-								.Alignment = 0,
-								.Width = static_cast<uint32_t>(width),
-								.Height = static_cast<uint32_t>(height),
-								.DepthOrArraySize = 1,
-								.MipLevels = 1,
-								.Format = DXGI_FORMAT_R8_UNORM,
-								.SampleDesc = {.Count = 1, .Quality = 0 },
-								.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
-								.Flags = D3D12_RESOURCE_FLAG_NONE,
+						for (uint32_t i = 0; i < textureNum; ++i)
+						{
+							const MComPtr<ID3D12Resource>& texture = bMaterialTextureArrays ? materialTextureArrays[i] : rustedIron2Textures[i];
+							const D3D12_RESOURCE_DESC desc = texture->GetDesc();
+
+							D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
+								.Format = desc.Format,
+								.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+								.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+								.Texture2D{
+									.MipLevels = desc.MipLevels,
+								},
 							};
 
-							const HRESULT hrBufferCreated = device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&rustedIron2RoughnessTexture));
-							if (FAILED(hrBufferCreated))
-							{
-								SA_LOG(L"Create RustedIron2 Roughness Texture failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
-
-							const bool bSubmitSuccess = SubmitTextureToGPU(rustedIron2RoughnessTexture, width, height, channels, DXGI_FORMAT_R8_UNORM, inData, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-							if (!bSubmitSuccess)
-							{
-								SA_LOG(L"RustedIron2 Roughness Texture submit failed!", Error, DX12);
-								return EXIT_FAILURE;
-							}
-
-							stbi_image_free(inData);
-
-
-							// Create View
+							if constexpr (bMaterialTextureArrays)
 							{
-								D3D12_SHADER_RESOURCE_VIEW_DESC viewDesc{
-									.Format = DXGI_FORMAT_R8_UNORM,
-									.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
-									.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
-									.Texture2D{
-										.MipLevels = 1,
-									},
+								viewDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+								viewDesc.Texture2DArray = D3D12_TEX2D_ARRAY_SRV{
+									.MipLevels = desc.MipLevels,
+									.FirstArraySlice = 0,
+									.ArraySize = desc.DepthOrArraySize,
 								};
-
-								device->CreateShaderResourceView(rustedIron2RoughnessTexture.Get(), &viewDesc, cpuHandle);
-								cpuHandle.ptr += srvOffset;
 							}
+
+							device->CreateShaderResourceView(texture.Get(), &viewDesc, cpuHandle);
+							cpuHandle.ptr += srvOffset;
 						}
 					}
 				}
@@ -1828,8 +2769,20 @@ int main()
 						return EXIT_FAILURE;
 					}
 
-					const SA::Mat4f transform = SA::Mat4f::MakeTranslation(spherePosition);
-					const bool bSubmitSuccess = SubmitBufferToGPU(objectBuffer, desc.Width, &transform, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+					const PositionDequantization dequantization = ComputePositionDequantization(sphereBounds);
+
+					// Right-handed glTF data: mirror z (counter-clockwise front faces become clockwise).
+					const SA::Mat4f handedness = SA::Mat4f::MakeScale(SA::Vec3f(1.0f, 1.0f, bSphereRightHanded ? -1.0f : 1.0f));
+
+					const ObjectUBO objectUBO{
+						.transform = SA::Mat4f::MakeTranslation(spherePosition) * handedness,
+						.positionDequantScale = SA::Vec3f(dequantization.scale.x, dequantization.scale.y, dequantization.scale.z),
+						.tangentHandedness = bSphereRightHanded ? -1.0f : 1.0f,
+						.positionDequantOffset = SA::Vec3f(dequantization.offset.x, dequantization.offset.y, dequantization.offset.z),
+						.materialIndex = rustedIron2MaterialIndex,
+					};
+
+					const bool bSubmitSuccess = SubmitBufferToGPU(uploadBatch, objectBuffer, desc.Width, &objectUBO);
 					if (!bSubmitSuccess)
 					{
 						SA_LOG(L"Sphere Object Buffer submit failed!", Error, DX12);
@@ -1880,7 +2833,7 @@ int main()
 						}
 					};
 
-					const bool bSubmitSuccess = SubmitBufferToGPU(pointLightBuffer, desc.Width, pointlightsUBO.data(), D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+					const bool bSubmitSuccess = SubmitBufferToGPU(uploadBatch, pointLightBuffer, desc.Width, pointlightsUBO.data());
 					if (!bSubmitSuccess)
 					{
 						SA_LOG(L"Sphere PointLight submit failed!", Error, DX12);
@@ -1903,7 +2856,14 @@ int main()
 					}
 				}
 
-				cmdLists[0]->Close();
+				/**
+				* Submit all the copies at once without waiting:
+				* the graphics queue only waits for the copy queue on the first frame using these resources.
+				*/
+				sceneUploadFenceValue = ExecuteUploadBatch(uploadBatch);
+
+				// Ring space is reserved at record time: the CPU-side high-water mark is final once the batch is recorded.
+				SA_LOG((L"Upload Ring high-water mark after loading: %1 / %2 bytes.", uploadRing.highWaterMark, uploadRing.capacity), Info, DX12);
 			}
 		}
 	}
@@ -2117,7 +3077,55 @@ int main()
 						cmd->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 						cmd->IASetVertexBuffers(0, static_cast<UINT>(sphereVertexBufferViews.size()), sphereVertexBufferViews.data());
 						cmd->IASetIndexBuffer(&sphereIndexBufferView);
-						cmd->DrawIndexedInstanced(sphereIndexCount, 1, 0, 0, 0);
+
+						// Sphere transform is a translation only: camera in mesh space.
+						const Float3 cameraMeshPosition{
+							cameraTr.position.x - spherePosition.x,
+							cameraTr.position.y - spherePosition.y,
+							cameraTr.position.z - spherePosition.z,
+						};
+
+						for (const Submesh& submesh : sphereSubmeshes)
+						{
+							// Meshlets are built on LOD 0 only.
+							if (const MeshLOD* lod = SelectLOD(submesh, sphereLODs, cameraMeshPosition))
+							{
+								cmd->DrawIndexedInstanced(lod->indexNum, 1, lod->indexOffset, static_cast<INT>(submesh.baseVertex), 0);
+								continue;
+							}
+
+							if (!bMeshletCulling || submesh.meshletNum == 0u)
+							{
+								cmd->DrawIndexedInstanced(submesh.indexNum, 1, submesh.indexOffset, static_cast<INT>(submesh.baseVertex), 0);
+								continue;
+							}
+
+							// Merge consecutive visible meshlets into a single draw.
+							uint32_t runTriangleOffset = 0u;
+							uint32_t runTriangleNum = 0u;
+
+							for (uint32_t i = 0; i < submesh.meshletNum; ++i)
+							{
+								const Meshlet& meshlet = sphereMeshlets[submesh.meshletOffset + i];
+
+								if (IsMeshletBackfacing(meshlet, cameraMeshPosition))
+									continue;
+
+								if (runTriangleNum && runTriangleOffset + runTriangleNum == meshlet.triangleOffset)
+									runTriangleNum += meshlet.triangleNum;
+								else
+								{
+									if (runTriangleNum)
+										cmd->DrawIndexedInstanced(runTriangleNum * 3, 1, runTriangleOffset * 3, static_cast<INT>(submesh.baseVertex), 0);
+
+									runTriangleOffset = meshlet.triangleOffset;
+									runTriangleNum = meshlet.triangleNum;
+								}
+							}
+
+							if (runTriangleNum)
+								cmd->DrawIndexedInstanced(runTriangleNum * 3, 1, runTriangleOffset * 3, static_cast<INT>(submesh.baseVertex), 0);
+						}
 					}
 
 
@@ -2141,6 +3149,9 @@ int main()
 
 					cmd->Close();
 
+					// Scene resources are uploaded on the copy queue: wait for them on first use only.
+					GraphicsQueueWaitUpload(sceneUploadFenceValue);
+
 					// Execute the command list.
 					ID3D12CommandList* ppCommandLists[] = { cmd.Get() };
 					graphicsQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
@@ -2168,6 +3179,9 @@ int main()
 				}
 			}
 
+			// Recycle executed upload batches and ring memory.
+			ReleaseCompletedUploadBatches();
+
 			SA_LOG_END_OF_FRAME();
 		}
 	}
@@ -2178,6 +3192,8 @@ int main()
 		// Renderer
 		{
 			WaitDeviceIdle();
+			WaitUploadFence(uploadFenceValue);
+			ReleaseCompletedUploadBatches();
 
 			// Resources
 			{
@@ -2199,10 +3215,11 @@ int main()
 				{
 					// RustedIron2
 					{
-						rustedIron2AlbedoTexture = nullptr;
-						rustedIron2NormalTexture = nullptr;
-						rustedIron2MetallicTexture = nullptr;
-						rustedIron2RoughnessTexture = nullptr;
+						for (MComPtr<ID3D12Resource>& texture : rustedIron2Textures)
+							texture = nullptr;
+
+						for (MComPtr<ID3D12Resource>& textureArray : materialTextureArrays)
+							textureArray = nullptr;
 					}
 				}
 
@@ -2243,6 +3260,20 @@ int main()
 				srvHeap = nullptr;
 			}
 
+			// Upload Ring
+			{
+				SA_LOG((L"Upload Ring high-water mark: %1 / %2 bytes.", uploadRing.highWaterMark, uploadRing.capacity), Info, DX12);
+
+				uploadRing.buffer->Unmap(0, nullptr);
+				uploadRing = UploadRing{};
+			}
+
+			// Upload Batches
+			{
+				freeUploadBatches.clear();
+				submittedUploadBatches.clear();
+			}
+
 			// Commands
 			{
 				cmdLists.fill(nullptr);
@@ -2269,6 +3300,9 @@ int main()
 				{
 					CloseHandle(deviceFenceEvent);
 					deviceFence = nullptr;
+
+					CloseHandle(uploadFenceEvent);
+					uploadFence = nullptr;
 				}
 
 				// Queue
@@ -2277,6 +3311,11 @@ int main()
 					{
 						graphicsQueue = nullptr;
 					}
+
+					// Copy
+					{
+						copyQueue = nullptr;
+					}
 				}
 
 #if SA_DEBUG
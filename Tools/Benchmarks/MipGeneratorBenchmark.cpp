@@ -0,0 +1,114 @@
+/**
+* MipGenerator benchmark (CPU only, no GPU required).
+*
+* Usage: MipGeneratorBenchmark [image.png...]
+* Without arguments, runs on a synthetic 4096x4096 image.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include "Texture/MipGenerator.hpp"
+
+namespace
+{
+	constexpr uint32_t runNum = 5u;
+
+	const char* GetFormatName(ImageFormat _format)
+	{
+		switch (_format)
+		{
+			case ImageFormat::R8:
+				return "R8";
+			case ImageFormat::RGBA8:
+				return "RGBA8";
+			case ImageFormat::RGBA8_SRGB:
+				return "RGBA8_SRGB";
+			default:
+				return "Unknown";
+		}
+	}
+
+	void Run(const char* _name, const uint8_t* _data, uint32_t _width, uint32_t _height, ImageFormat _format, MipFilter _filter)
+	{
+		double bestMs = 1e30;
+
+		for (uint32_t i = 0; i < runNum; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+
+			const MipChain chain = CreateMipChain(_data, _width, _height, _format, _filter);
+
+			const auto end = std::chrono::steady_clock::now();
+			const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+			if (ms < bestMs)
+				bestMs = ms;
+		}
+
+		const double mpix = static_cast<double>(_width) * _height / 1e6;
+
+		std::printf("%-40s %-11s %-7s %5ux%-5u %9.2f ms %9.1f MPix/s\n", _name, GetFormatName(_format),
+			_filter == MipFilter::Box ? "Box" : "Kaiser", _width, _height, bestMs, mpix / (bestMs / 1000.0));
+	}
+
+	void RunAll(const char* _name, const uint8_t* _rgba, const uint8_t* _r, uint32_t _width, uint32_t _height)
+	{
+		for (MipFilter filter : { MipFilter::Box, MipFilter::Kaiser })
+		{
+			Run(_name, _rgba, _width, _height, ImageFormat::RGBA8, filter);
+			Run(_name, _rgba, _width, _height, ImageFormat::RGBA8_SRGB, filter);
+			Run(_name, _r, _width, _height, ImageFormat::R8, filter);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::printf("Best of %u runs (full mip chain).\n", runNum);
+
+	if (argc <= 1)
+	{
+		constexpr uint32_t size = 4096u;
+
+		std::vector<uint8_t> rgba(size * size * 4);
+		std::vector<uint8_t> r(size * size);
+
+		std::mt19937 rng(42u);
+
+		for (uint8_t& value : rgba)
+			value = static_cast<uint8_t>(rng());
+
+		for (uint8_t& value : r)
+			value = static_cast<uint8_t>(rng());
+
+		RunAll("Synthetic noise", rgba.data(), r.data(), size, size);
+
+		return 0;
+	}
+
+	for (int i = 1; i < argc; ++i)
+	{
+		int width, height, channels;
+		uint8_t* const rgba = stbi_load(argv[i], &width, &height, &channels, 4);
+		uint8_t* const r = stbi_load(argv[i], &width, &height, &channels, 1);
+
+		if (!rgba || !r)
+		{
+			std::printf("Failed to load %s\n", argv[i]);
+			return 1;
+		}
+
+		RunAll(argv[i], rgba, r, static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+
+		stbi_image_free(rgba);
+		stbi_image_free(r);
+	}
+
+	return 0;
+}
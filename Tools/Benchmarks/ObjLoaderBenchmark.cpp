@@ -0,0 +1,184 @@
+/**
+* ObjLoader vs Assimp benchmark (CPU only, no GPU required).
+* Assimp runs with aiProcess_CalcTangentSpace, ObjLoader with GenerateTangents: both produce complete vertex streams.
+*
+* Usage: ObjLoaderBenchmark [model.obj...]
+* Without arguments, runs on Resources/Models/Shapes/sphere.obj (when run from the repository root)
+* and on large synthetic OBJ files (UV spheres written to the working directory).
+*/
+
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <algorithm>
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include "Mesh/ObjLoader.hpp"
+#include "Mesh/TangentGenerator.hpp"
+
+namespace
+{
+	constexpr uint32_t runNum = 3u;
+
+	template <typename FuncT>
+	double MeasureBestMs(FuncT&& _func)
+	{
+		double bestMs = 1e30;
+
+		for (uint32_t i = 0; i < runNum; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+
+			if (!_func())
+				return -1.0;
+
+			const auto end = std::chrono::steady_clock::now();
+
+			bestMs = (std::min)(bestMs, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return bestMs;
+	}
+
+	void Run(const char* _path)
+	{
+		FILE* const file = std::fopen(_path, "rb");
+
+		if (!file)
+		{
+			std::printf("%s not found: skipped.\n", _path);
+			return;
+		}
+
+		std::fseek(file, 0, SEEK_END);
+		const double sizeMB = static_cast<double>(std::ftell(file)) / (1024.0 * 1024.0);
+		std::fclose(file);
+
+		size_t objVertexNum = 0u;
+		size_t objTriangleNum = 0u;
+
+		const double objMs = MeasureBestMs([&]()
+		{
+			MeshData mesh;
+
+			if (!LoadObj(_path, mesh))
+				return false;
+
+			GenerateTangents(mesh);
+
+			objVertexNum = mesh.positions.size();
+			objTriangleNum = mesh.indices.size() / 3;
+
+			return true;
+		});
+
+		size_t assimpVertexNum = 0u;
+
+		const double assimpMs = MeasureBestMs([&]()
+		{
+			Assimp::Importer importer;
+
+			const aiScene* scene = importer.ReadFile(_path, aiProcess_CalcTangentSpace | aiProcess_ConvertToLeftHanded | aiProcess_Triangulate | aiProcess_SortByPType);
+			if (!scene)
+				return false;
+
+			assimpVertexNum = 0u;
+
+			for (uint32_t i = 0; i < scene->mNumMeshes; ++i)
+				assimpVertexNum += scene->mMeshes[i]->mNumVertices;
+
+			return true;
+		});
+
+		std::printf("%-40s %8.1f MB %9zu tris\n", _path, sizeMB, objTriangleNum);
+		std::printf("    ObjLoader %10.2f ms %8.1f MB/s %9zu vertices (welded)\n", objMs, sizeMB / (objMs / 1000.0), objVertexNum);
+		std::printf("    Assimp    %10.2f ms %8.1f MB/s %9zu vertices\n", assimpMs, sizeMB / (assimpMs / 1000.0), assimpVertexNum);
+
+		if (objMs > 0.0 && assimpMs > 0.0)
+			std::printf("    Speedup   %10.2fx\n", assimpMs / objMs);
+	}
+
+	/**
+	* UV sphere with _segmentNum x _segmentNum quads: v / vt / vn / f v/vt/vn (same layout as exporters output).
+	*/
+	bool WriteSyntheticObj(const char* _path, uint32_t _segmentNum)
+	{
+		FILE* const file = std::fopen(_path, "wb");
+
+		if (!file)
+			return false;
+
+		constexpr float pi = 3.14159265358979f;
+
+		for (const char* keyword : { "v", "vn" })
+		{
+			for (uint32_t y = 0; y <= _segmentNum; ++y)
+			{
+				for (uint32_t x = 0; x <= _segmentNum; ++x)
+				{
+					const float theta = pi * static_cast<float>(y) / static_cast<float>(_segmentNum);
+					const float phi = 2.0f * pi * static_cast<float>(x) / static_cast<float>(_segmentNum);
+
+					std::fprintf(file, "%s %.6f %.6f %.6f\n", keyword, std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+				}
+			}
+		}
+
+		for (uint32_t y = 0; y <= _segmentNum; ++y)
+		{
+			for (uint32_t x = 0; x <= _segmentNum; ++x)
+				std::fprintf(file, "vt %.6f %.6f\n", static_cast<float>(x) / static_cast<float>(_segmentNum), static_cast<float>(y) / static_cast<float>(_segmentNum));
+		}
+
+		for (uint32_t y = 0; y < _segmentNum; ++y)
+		{
+			for (uint32_t x = 0; x < _segmentNum; ++x)
+			{
+				const uint32_t i0 = y * (_segmentNum + 1) + x + 1;
+				const uint32_t i1 = i0 + 1;
+				const uint32_t i2 = i0 + _segmentNum + 1;
+				const uint32_t i3 = i2 + 1;
+
+				std::fprintf(file, "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n", i0, i0, i0, i2, i2, i2, i3, i3, i3, i1, i1, i1);
+			}
+		}
+
+		return std::fclose(file) == 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::printf("Best of %u runs.\n", runNum);
+
+	if (argc <= 1)
+	{
+		Run("Resources/Models/Shapes/sphere.obj");
+
+		for (uint32_t segmentNum : { 256u, 1024u })
+		{
+			const std::string path = "ObjLoaderBenchmark_" + std::to_string(segmentNum) + ".obj";
+
+			if (!WriteSyntheticObj(path.c_str(), segmentNum))
+			{
+				std::printf("Failed to write %s\n", path.c_str());
+				return 1;
+			}
+
+			Run(path.c_str());
+
+			std::remove(path.c_str());
+		}
+
+		return 0;
+	}
+
+	for (int i = 1; i < argc; ++i)
+		Run(argv[i]);
+
+	return 0;
+}
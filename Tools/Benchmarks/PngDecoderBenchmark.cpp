@@ -0,0 +1,136 @@
+/**
+* PngDecoder vs stb_image benchmark (CPU only, no GPU required).
+* Both decode from memory (file already mapped) to the channel count of the file, then to RGBA.
+* Outputs are compared: the decoder must match stb_image exactly.
+*
+* Usage: PngDecoderBenchmark [image.png...]
+* Without arguments, runs on the Resources/Textures/RustedIron2 PNG files (when run from the repository root).
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include "Core/MappedFile.hpp"
+#include "Texture/PngDecoder.hpp"
+
+namespace
+{
+	constexpr uint32_t runNum = 5u;
+
+	template <typename FuncT>
+	double MeasureBestMs(FuncT&& _func)
+	{
+		double bestMs = 1e30;
+
+		for (uint32_t i = 0; i < runNum; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+
+			if (!_func())
+				return -1.0;
+
+			const auto end = std::chrono::steady_clock::now();
+
+			bestMs = (std::min)(bestMs, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return bestMs;
+	}
+
+	bool Run(const char* _path, const MappedFile& _file, const PngInfo& _info, uint32_t _channelNum)
+	{
+		const uint64_t imageSize = static_cast<uint64_t>(_info.width) * _info.height * _channelNum;
+		std::vector<uint8_t> pixels(imageSize);
+
+		const double pngMs = MeasureBestMs([&]()
+		{
+			return DecodePng(_file.GetData(), _file.GetSize(), _channelNum, false, ImageView{ pixels.data(), _info.width, _info.height, static_cast<uint64_t>(_info.width) * _channelNum });
+		});
+
+		bool bSame = false;
+
+		const double stbMs = MeasureBestMs([&]()
+		{
+			int width, height, channels;
+			uint8_t* const stbPixels = stbi_load_from_memory(_file.GetData(), static_cast<int>(_file.GetSize()), &width, &height, &channels, static_cast<int>(_channelNum));
+
+			if (!stbPixels)
+				return false;
+
+			bSame = pngMs > 0.0 && std::memcmp(stbPixels, pixels.data(), imageSize) == 0;
+
+			stbi_image_free(stbPixels);
+
+			return true;
+		});
+
+		const double mpix = static_cast<double>(_info.width) * _info.height / 1e6;
+
+		std::printf("%-60s %5ux%-5u %u -> %u channels\n", _path, _info.width, _info.height, _info.channelNum, _channelNum);
+		std::printf("    PngDecoder %9.2f ms %8.1f MPix/s\n", pngMs, mpix / (pngMs / 1000.0));
+		std::printf("    stb_image  %9.2f ms %8.1f MPix/s\n", stbMs, mpix / (stbMs / 1000.0));
+
+		if (pngMs > 0.0 && stbMs > 0.0)
+			std::printf("    Speedup    %9.2fx %s\n", stbMs / pngMs, bSame ? "(identical output)" : "(OUTPUT MISMATCH)");
+
+		return bSame;
+	}
+
+	bool Run(const char* _path)
+	{
+		MappedFile file;
+
+		if (!file.Open(_path))
+		{
+			std::printf("%s not found: skipped.\n", _path);
+			return true;
+		}
+
+		PngInfo info;
+
+		if (!ParsePngHeader(file.GetData(), file.GetSize(), info) || !IsPngDecodeSupported(info))
+		{
+			std::printf("%s: not a PNG file supported by PngDecoder (stb_image fallback): skipped.\n", _path);
+			return true;
+		}
+
+		bool bSuccess = Run(_path, file, info, info.channelNum);
+
+		if (info.channelNum != 4u)
+			bSuccess &= Run(_path, file, info, 4u);
+
+		return bSuccess;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::printf("Best of %u runs.\n", runNum);
+
+	bool bSuccess = true;
+
+	if (argc <= 1)
+	{
+		for (const char* path : {
+			"Resources/Textures/RustedIron2/rustediron2_basecolor.png",
+			"Resources/Textures/RustedIron2/rustediron2_metallic.png",
+			"Resources/Textures/RustedIron2/rustediron2_normal.png",
+			"Resources/Textures/RustedIron2/rustediron2_roughness.png" })
+		{
+			bSuccess &= Run(path);
+		}
+	}
+	else
+	{
+		for (int i = 1; i < argc; ++i)
+			bSuccess &= Run(argv[i]);
+	}
+
+	return bSuccess ? 0 : 1;
+}
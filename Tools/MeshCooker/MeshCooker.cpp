@@ -0,0 +1,345 @@
+/**
+* Offline mesh cooker (CPU only, no GPU required).
+* Source model (any Assimp format) -> import + post-processing -> welding -> tangents -> optimization -> meshlets -> LODs -> .mesh binary file (see MeshFile.hpp).
+* Every mesh of the scene hierarchy is imported as a submesh (node transforms baked), drawn with its own index range.
+* Assimp is only required by this tool: the renderer memory-maps the cooked file.
+* OBJ files use the faster ObjLoader (single submesh) unless --importer assimp is given (one submesh per Assimp mesh).
+* GLB files use GltfLoader (one submesh per primitive, node transforms ignored) unless --importer assimp is given.
+*
+* Usage: MeshCooker <input.obj> <output.mesh> [--vertex-format quantized|float] [--importer auto|assimp] [--lod-count <N>] [--lod-ratio <ratio>] [--lod-error <error>] [--weld-epsilon <epsilon>] [--compression none|meshcodec]
+* Vertex format (default quantized) must match the renderer input layout (see bQuantizedVertexFormat in main.cpp).
+* LODs (see LODSettings): each level keeps --lod-ratio of the previous triangles, up to --lod-error (relative to the submesh extent).
+* Welding (see WeldSettings): vertices closer than --weld-epsilon (relative to the submesh extent) with matching attributes are merged.
+* Compression (default meshcodec, see MeshCodec.hpp): vertex streams, indices and meshlet arrays are stored compressed, decoded at load time straight into staging memory.
+*/
+
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include "Mesh/MeshFile.hpp"
+#include "Mesh/GltfLoader.hpp"
+#include "Mesh/Meshlet.hpp"
+#include "Mesh/ObjLoader.hpp"
+#include "Mesh/MeshOptimizer.hpp"
+#include "Mesh/MeshSimplifier.hpp"
+#include "Mesh/TangentGenerator.hpp"
+#include "Mesh/VertexWelder.hpp"
+
+namespace
+{
+	/**
+	* Import one Assimp mesh with 0-based indices.
+	* Node transform is baked: normals use the inverse transpose (non-uniform scale).
+	* Tangents are generated after import (see GenerateTangents).
+	*/
+	bool ImportMesh(const aiMesh& _inMesh, const aiMatrix4x4& _transform, MeshData& _outMesh)
+	{
+		if (!_inMesh.HasNormals() || !_inMesh.HasTextureCoords(0))
+		{
+			std::printf("Mesh [%s] requires normals and UVs.\n", _inMesh.mName.C_Str());
+			return false;
+		}
+
+		const aiMatrix3x3 normalTransform = aiMatrix3x3(_transform).Inverse().Transpose();
+
+		_outMesh.positions.resize(_inMesh.mNumVertices);
+		_outMesh.normals.resize(_inMesh.mNumVertices);
+		_outMesh.uvs.resize(_inMesh.mNumVertices);
+
+		for (uint32_t i = 0; i < _inMesh.mNumVertices; ++i)
+		{
+			const aiVector3D position = _transform * _inMesh.mVertices[i];
+			const aiVector3D normal = (normalTransform * _inMesh.mNormals[i]).NormalizeSafe();
+			const aiVector3D& uv = _inMesh.mTextureCoords[0][i];
+
+			_outMesh.positions[i] = Float3{ position.x, position.y, position.z };
+			_outMesh.normals[i] = Float3{ normal.x, normal.y, normal.z };
+			_outMesh.uvs[i] = Float2{ uv.x, uv.y };
+		}
+
+		_outMesh.indices.reserve(_inMesh.mNumFaces * 3);
+
+		for (uint32_t i = 0; i < _inMesh.mNumFaces; ++i)
+		{
+			const aiFace& face = _inMesh.mFaces[i];
+
+			// Skip points and lines (aiProcess_Triangulate keeps them).
+			if (face.mNumIndices != 3)
+				continue;
+
+			_outMesh.indices.push_back(face.mIndices[0]);
+			_outMesh.indices.push_back(face.mIndices[1]);
+			_outMesh.indices.push_back(face.mIndices[2]);
+		}
+
+		return true;
+	}
+
+	/**
+	* Import every mesh referenced by _node and its children: one submesh per node mesh.
+	* Meshes without triangles are skipped.
+	*/
+	bool ImportNode(const aiScene& _scene, const aiNode& _node, const aiMatrix4x4& _parentTransform, MeshData& _outMesh)
+	{
+		const aiMatrix4x4 transform = _parentTransform * _node.mTransformation;
+
+		for (uint32_t i = 0; i < _node.mNumMeshes; ++i)
+		{
+			const aiMesh& inMesh = *_scene.mMeshes[_node.mMeshes[i]];
+
+			if (!(inMesh.mPrimitiveTypes & aiPrimitiveType_TRIANGLE))
+				continue;
+
+			MeshData submesh;
+
+			if (!ImportMesh(inMesh, transform, submesh))
+				return false;
+
+			AppendSubmesh(_outMesh, submesh);
+		}
+
+		for (uint32_t i = 0; i < _node.mNumChildren; ++i)
+		{
+			if (!ImportNode(_scene, *_node.mChildren[i], transform, _outMesh))
+				return false;
+		}
+
+		return true;
+	}
+
+	/// Import every mesh of any Assimp supported format.
+	bool ImportScene(const char* _path, MeshData& _outMesh)
+	{
+		Assimp::Importer importer;
+
+		// SortByPType: split meshes mixing triangles with points / lines.
+		const aiScene* scene = importer.ReadFile(_path, aiProcess_ConvertToLeftHanded | aiProcess_Triangulate | aiProcess_SortByPType);
+		if (!scene || !scene->mRootNode || scene->mNumMeshes == 0)
+		{
+			std::printf("Assimp loading failed: %s\n", importer.GetErrorString());
+			return false;
+		}
+
+		return ImportNode(*scene, *scene->mRootNode, aiMatrix4x4(), _outMesh);
+	}
+
+	bool HasExtension(const char* _path, const char* _extension)
+	{
+		const size_t pathLength = std::strlen(_path);
+		const size_t extensionLength = std::strlen(_extension);
+
+		if (pathLength < extensionLength)
+			return false;
+
+		for (size_t i = 0; i < extensionLength; ++i)
+		{
+			if (std::tolower(static_cast<unsigned char>(_path[pathLength - extensionLength + i])) != _extension[i])
+				return false;
+		}
+
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* const usage = "Usage: MeshCooker <input.obj> <output.mesh> [--vertex-format quantized|float] [--importer auto|assimp] [--lod-count <N>] [--lod-ratio <ratio>] [--lod-error <error>] [--weld-epsilon <epsilon>] [--compression none|meshcodec]\n";
+
+	if (argc < 3)
+	{
+		std::printf("%s", usage);
+		return 1;
+	}
+
+	const char* const inputPath = argv[1];
+	const char* const outputPath = argv[2];
+
+	bool bQuantizeVertices = true;
+	bool bForceAssimp = false;
+	bool bCompress = true;
+	LODSettings lodSettings;
+	WeldSettings weldSettings;
+
+	for (int i = 3; i < argc; i += 2)
+	{
+		if (i + 1 >= argc)
+		{
+			std::printf("%s", usage);
+			return 1;
+		}
+
+		const char* const value = argv[i + 1];
+		bool bValid = false;
+
+		if (std::strcmp(argv[i], "--vertex-format") == 0)
+		{
+			bValid = std::strcmp(value, "quantized") == 0 || std::strcmp(value, "float") == 0;
+			bQuantizeVertices = std::strcmp(value, "quantized") == 0;
+		}
+		else if (std::strcmp(argv[i], "--importer") == 0)
+		{
+			bValid = std::strcmp(value, "auto") == 0 || std::strcmp(value, "assimp") == 0;
+			bForceAssimp = std::strcmp(value, "assimp") == 0;
+		}
+		else if (std::strcmp(argv[i], "--lod-count") == 0)
+		{
+			lodSettings.lodNum = static_cast<uint32_t>(std::atoi(value));
+			bValid = lodSettings.lodNum <= 8u;
+		}
+		else if (std::strcmp(argv[i], "--lod-ratio") == 0)
+		{
+			lodSettings.triangleRatio = static_cast<float>(std::atof(value));
+			bValid = lodSettings.triangleRatio > 0.0f && lodSettings.triangleRatio < 1.0f;
+		}
+		else if (std::strcmp(argv[i], "--lod-error") == 0)
+		{
+			lodSettings.maxError = static_cast<float>(std::atof(value));
+			bValid = lodSettings.maxError > 0.0f;
+		}
+		else if (std::strcmp(argv[i], "--weld-epsilon") == 0)
+		{
+			weldSettings.positionEpsilon = static_cast<float>(std::atof(value));
+			bValid = weldSettings.positionEpsilon >= 0.0f && weldSettings.positionEpsilon < 0.01f;
+		}
+		else if (std::strcmp(argv[i], "--compression") == 0)
+		{
+			bValid = std::strcmp(value, "none") == 0 || std::strcmp(value, "meshcodec") == 0;
+			bCompress = std::strcmp(value, "meshcodec") == 0;
+		}
+
+		if (!bValid)
+		{
+			std::printf("Invalid option: %s %s\n%s", argv[i], value, usage);
+			return 1;
+		}
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	MeshData mesh;
+
+	const bool bUseObjLoader = !bForceAssimp && HasExtension(inputPath, ".obj");
+	const bool bUseGltfLoader = !bForceAssimp && HasExtension(inputPath, ".glb");
+
+	if (bUseObjLoader)
+	{
+		if (!LoadObj(inputPath, mesh))
+		{
+			std::printf("OBJ loading failed: %s\n", inputPath);
+			return 1;
+		}
+	}
+	else if (bUseGltfLoader)
+	{
+		if (!LoadGlb(inputPath, mesh))
+		{
+			std::printf("GLB loading failed (normals and UVs are required): %s\n", inputPath);
+			return 1;
+		}
+	}
+	else if (!ImportScene(inputPath, mesh))
+		return 1;
+
+	std::printf("Import (%s): %.1f ms\n", bUseObjLoader ? "ObjLoader" : (bUseGltfLoader ? "GltfLoader" : "Assimp"),
+		std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+	if (mesh.submeshes.empty())
+	{
+		std::printf("No triangle mesh in %s\n", inputPath);
+		return 1;
+	}
+
+	// Importers keep one vertex per face corner (no aiProcess_JoinIdenticalVertices).
+	{
+		const auto weldStart = std::chrono::steady_clock::now();
+
+		const std::vector<WeldStats> weldStats = WeldVertices(mesh, weldSettings);
+
+		std::printf("Welding: %.1f ms\n", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - weldStart).count());
+
+		for (size_t i = 0; i < weldStats.size(); ++i)
+		{
+			const WeldStats& stats = weldStats[i];
+
+			std::printf("    Submesh %zu: %u -> %u vertices (-%.1f%%), %u degenerate triangles removed\n", i,
+				stats.vertexNumBefore, stats.vertexNumAfter,
+				stats.vertexNumBefore ? 100.0 * (stats.vertexNumBefore - stats.vertexNumAfter) / stats.vertexNumBefore : 0.0,
+				stats.degenerateTriangleNum);
+		}
+	}
+
+	// MikkTSpace tangents (normal map baker convention), before any vertex reordering.
+	{
+		const auto tangentStart = std::chrono::steady_clock::now();
+		const size_t importVertexNum = mesh.positions.size();
+
+		GenerateTangents(mesh);
+
+		std::printf("Tangents: %.1f ms, %zu vertices (+%zu split by handedness)\n",
+			std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tangentStart).count(),
+			mesh.positions.size(), mesh.positions.size() - importVertexNum);
+	}
+
+	// Triangle order (vertex cache, overdraw) then vertex order (fetch locality).
+	const VertexCacheStats statsBefore = AnalyzeVertexCache(mesh);
+
+	OptimizeMesh(mesh);
+
+	const VertexCacheStats statsAfter = AnalyzeVertexCache(mesh);
+
+	std::printf("Vertex cache (FIFO %u): ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n", vertexCacheSize,
+		statsBefore.acmr, statsAfter.acmr, statsBefore.atvr, statsAfter.atvr);
+
+	// Meshlets last: built from the final index order.
+	BuildMeshlets(mesh);
+
+	std::printf("Meshlets (%u vertices, %u triangles max): %zu, %.1f triangles / meshlet\n", meshletMaxVertices, meshletMaxTriangles,
+		mesh.meshlets.size(), mesh.meshlets.empty() ? 0.0 : double(mesh.meshletTriangles.size()) / double(mesh.meshlets.size()));
+
+	BuildMeshLODs(mesh, lodSettings);
+
+	for (const Submesh& submesh : mesh.submeshes)
+	{
+		std::printf("LODs: %u triangles", submesh.indexNum / 3);
+
+		for (uint32_t i = submesh.lodOffset; i < submesh.lodOffset + submesh.lodNum; ++i)
+			std::printf(" -> %u (error %g)", mesh.lods[i].indexNum / 3, mesh.lods[i].error);
+
+		std::printf("\n");
+	}
+
+	ComputeMeshBounds(mesh);
+
+	if (!WriteMeshFile(outputPath, mesh, bQuantizeVertices, bCompress))
+	{
+		std::printf("Failed to write %s\n", outputPath);
+		return 1;
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+
+	// LOD 0 only.
+	size_t triangleNum = 0u;
+
+	for (const Submesh& submesh : mesh.submeshes)
+		triangleNum += submesh.indexNum / 3;
+
+	std::error_code fileSizeError;
+	const uintmax_t fileSize = std::filesystem::file_size(outputPath, fileSizeError);
+
+	std::printf("Cooked %s -> %s (%zu submeshes, %zu vertices, %zu triangles, %s indices, %.1f KB %s) in %.1f ms\n", inputPath, outputPath,
+		mesh.submeshes.size(), mesh.positions.size(), triangleNum,
+		SelectIndexFormat(mesh) == IndexFormat::UInt16 ? "16-bit" : "32-bit",
+		fileSizeError ? 0.0 : double(fileSize) / 1024.0, bCompress ? "compressed" : "raw",
+		std::chrono::duration<double, std::milli>(end - start).count());
+
+	return 0;
+}
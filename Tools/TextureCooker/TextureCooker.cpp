@@ -0,0 +1,410 @@
+/**
+* Offline texture cooker (CPU only, no GPU required).
+* Source image -> full mip chain -> block compression -> .dds container.
+* The runtime memory-maps the .dds and copies its subresources straight into staging memory: no decode at load time.
+*
+* Usage: TextureCooker <input.png> <output.dds> [--format bc1|bc1srgb|bc3|bc3srgb|bc4|bc5|bc7|bc7srgb] [--quality fast|normal|high] [--filter box|kaiser]
+* Without --format, the format is deduced from the file name suffix:
+*   - *_normal: BC5 (XY only, Z is rebuilt in shader).
+*   - *_metallic, *_roughness, *_ao, *_height: BC4.
+*   - *_orm: BC7 (linear).
+*   - anything else (*_basecolor, *_albedo...): BC7 sRGB.
+*
+* Channel packing: TextureCooker --pack <r.png|none> <g.png|none> <b.png|none> <output.dds> [options]
+* Each input is loaded as a single channel image, missing channels are 1 (alpha too), default format BC7 (linear).
+* ie. ORM: --pack <ao.png|none> <roughness.png> <metallic.png> <*_orm.dds> (see ChannelPacker.hpp).
+*
+* <output.ktx2>: Basis Universal UASTC + Zstd instead of BC (requires BASISU_SUPPORT, see KTX2.hpp),
+* same mip chain, transcoded at load time to the BC format of the texture usage (--format only sets the sRGB transfer function).
+*/
+
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include "Texture/DDS.hpp"
+#include "Texture/ChannelPacker.hpp"
+
+#ifndef BASISU_SUPPORT
+#define BASISU_SUPPORT 0
+#endif
+
+#if BASISU_SUPPORT
+#include <thread>
+#include <algorithm>
+
+#include <encoder/basisu_comp.h>
+#endif
+
+namespace
+{
+	struct CookSettings
+	{
+		BCFormat format = BCFormat::BC7;
+		bool bSRGB = true;
+
+		// Offline: favor quality over speed.
+		BCQuality quality = BCQuality::High;
+		MipFilter filter = MipFilter::Kaiser;
+	};
+
+	bool EndsWith(const std::string& _str, const char* _suffix)
+	{
+		const size_t suffixLength = std::strlen(_suffix);
+
+		return _str.size() >= suffixLength && _str.compare(_str.size() - suffixLength, suffixLength, _suffix) == 0;
+	}
+
+	/// _bPacked: channel packed output (--pack), BC7 linear by default.
+	void DeduceFormat(const char* _path, bool _bPacked, CookSettings& _settings)
+	{
+		std::string stem = _path;
+
+		const size_t slash = stem.find_last_of("/\\");
+		if (slash != std::string::npos)
+			stem.erase(0, slash + 1);
+
+		const size_t dot = stem.find_last_of('.');
+		if (dot != std::string::npos)
+			stem.erase(dot);
+
+		for (char& c : stem)
+			c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+		if (EndsWith(stem, "_normal"))
+		{
+			_settings.format = BCFormat::BC5;
+			_settings.bSRGB = false;
+		}
+		else if (EndsWith(stem, "_metallic") || EndsWith(stem, "_roughness") || EndsWith(stem, "_ao") || EndsWith(stem, "_height"))
+		{
+			_settings.format = BCFormat::BC4;
+			_settings.bSRGB = false;
+		}
+		else if (EndsWith(stem, "_orm"))
+		{
+			_settings.format = BCFormat::BC7;
+			_settings.bSRGB = false;
+		}
+		else
+		{
+			// Packed channels are linear data.
+			_settings.format = BCFormat::BC7;
+			_settings.bSRGB = !_bPacked;
+		}
+	}
+
+	bool ParseFormat(const char* _str, CookSettings& _settings)
+	{
+		const struct
+		{
+			const char* name;
+			BCFormat format;
+			bool bSRGB;
+		} formats[] = {
+			{ "bc1", BCFormat::BC1, false },
+			{ "bc1srgb", BCFormat::BC1, true },
+			{ "bc3", BCFormat::BC3, false },
+			{ "bc3srgb", BCFormat::BC3, true },
+			{ "bc4", BCFormat::BC4, false },
+			{ "bc5", BCFormat::BC5, false },
+			{ "bc7", BCFormat::BC7, false },
+			{ "bc7srgb", BCFormat::BC7, true },
+		};
+
+		for (const auto& format : formats)
+		{
+			if (std::strcmp(_str, format.name) == 0)
+			{
+				_settings.format = format.format;
+				_settings.bSRGB = format.bSRGB;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool ParseQuality(const char* _str, CookSettings& _settings)
+	{
+		if (std::strcmp(_str, "fast") == 0)
+			_settings.quality = BCQuality::Fast;
+		else if (std::strcmp(_str, "normal") == 0)
+			_settings.quality = BCQuality::Normal;
+		else if (std::strcmp(_str, "high") == 0)
+			_settings.quality = BCQuality::High;
+		else
+			return false;
+
+		return true;
+	}
+
+	bool ParseFilter(const char* _str, CookSettings& _settings)
+	{
+		if (std::strcmp(_str, "box") == 0)
+			_settings.filter = MipFilter::Box;
+		else if (std::strcmp(_str, "kaiser") == 0)
+			_settings.filter = MipFilter::Kaiser;
+		else
+			return false;
+
+		return true;
+	}
+
+	void PrintUsage()
+	{
+		std::printf("Usage: TextureCooker <input.png> <output.dds|output.ktx2> [--format bc1|bc1srgb|bc3|bc3srgb|bc4|bc5|bc7|bc7srgb] [--quality fast|normal|high] [--filter box|kaiser]\n");
+		std::printf("       TextureCooker --pack <r.png|none> <g.png|none> <b.png|none> <output.dds|output.ktx2> [options]\n");
+	}
+
+	/**
+	* Encode _mips as a Basis Universal UASTC texture (Zstd supercompressed) and write it in a .ktx2 file.
+	* Mips are given to the encoder as-is (same filter as .dds). Single channel mips are replicated to RGB.
+	*/
+	bool WriteBasisKTX2(const char* _path, const MipChain& _mips, bool _bSRGB, size_t& _outSize)
+	{
+#if BASISU_SUPPORT
+		basisu::basisu_encoder_init();
+
+		const uint32_t threadNum = (std::max)(1u, std::thread::hardware_concurrency());
+		basisu::job_pool jobPool(threadNum);
+
+		basisu::basis_compressor_params params;
+		params.m_uastc = true;
+		params.m_create_ktx2_file = true;
+		params.m_ktx2_uastc_supercompression = basist::KTX2_SS_ZSTANDARD;
+		params.m_ktx2_srgb_transfer_func = _bSRGB;
+		params.m_perceptual = _bSRGB;
+		params.m_read_source_images = false;
+		params.m_write_output_basis_files = false;
+		params.m_status_output = false;
+		params.m_multithreading = threadNum > 1u;
+		params.m_pJob_pool = &jobPool;
+
+		params.m_source_images.resize(1);
+		params.m_source_mipmap_images.resize(1);
+
+		const uint32_t channelNum = GetImageFormatChannelNum(_mips.format);
+
+		for (size_t i = 0; i < _mips.levels.size(); ++i)
+		{
+			const ImageView& level = _mips.levels[i];
+			basisu::image image(level.width, level.height);
+
+			for (uint32_t y = 0; y < level.height; ++y)
+			{
+				const uint8_t* const row = level.data + y * level.rowPitch;
+
+				for (uint32_t x = 0; x < level.width; ++x)
+				{
+					const uint8_t* const pixel = row + x * channelNum;
+
+					image(x, y) = channelNum == 1u ? basisu::color_rgba(pixel[0], pixel[0], pixel[0], 255) : basisu::color_rgba(pixel[0], pixel[1], pixel[2], pixel[3]);
+				}
+			}
+
+			if (i == 0)
+				params.m_source_images[0] = image;
+			else
+				params.m_source_mipmap_images[0].push_back(image);
+		}
+
+		basisu::basis_compressor compressor;
+
+		if (!compressor.init(params) || compressor.process() != basisu::basis_compressor::cECSuccess)
+			return false;
+
+		const basisu::uint8_vec& ktx2 = compressor.get_output_ktx2_file();
+
+		FILE* const file = std::fopen(_path, "wb");
+		if (!file)
+			return false;
+
+		bool bSuccess = std::fwrite(ktx2.data(), 1, ktx2.size(), file) == ktx2.size();
+		bSuccess &= std::fclose(file) == 0;
+
+		_outSize = ktx2.size();
+
+		return bSuccess;
+#else
+		(void)_path;
+		(void)_mips;
+		(void)_bSRGB;
+		(void)_outSize;
+
+		std::printf("TextureCooker built without BASISU_SUPPORT: .ktx2 output is not supported\n");
+
+		return false;
+#endif
+	}
+
+	/**
+	* Load the --pack inputs as single channel images and pack them in level 0 of a new _format (RGBA8 or RGBA8_SRGB) mip chain.
+	*/
+	bool LoadPackedImage(char** _inputPaths, ImageFormat _format, MipChain& _outMips)
+	{
+		uint8_t* sourceData[3]{};
+		ChannelSource channels[4];
+
+		int width = 0;
+		int height = 0;
+		bool bSuccess = true;
+
+		for (uint32_t i = 0; i < 3u && bSuccess; ++i)
+		{
+			if (std::strcmp(_inputPaths[i], "none") == 0)
+				continue;
+
+			int sourceWidth, sourceHeight, sourceChannels;
+			sourceData[i] = stbi_load(_inputPaths[i], &sourceWidth, &sourceHeight, &sourceChannels, 1);
+
+			if (!sourceData[i])
+			{
+				std::printf("Failed to load %s: %s\n", _inputPaths[i], stbi_failure_reason());
+				bSuccess = false;
+			}
+			else if (width != 0 && (sourceWidth != width || sourceHeight != height))
+			{
+				std::printf("%s: packed inputs must have the same size\n", _inputPaths[i]);
+				bSuccess = false;
+			}
+
+			width = sourceWidth;
+			height = sourceHeight;
+			channels[i].data = sourceData[i];
+		}
+
+		if (bSuccess && width == 0)
+		{
+			std::printf("--pack: at least one input is required\n");
+			bSuccess = false;
+		}
+
+		if (bSuccess)
+		{
+			_outMips = AllocateMipChain(static_cast<uint32_t>(width), static_cast<uint32_t>(height), _format);
+			PackChannels(channels, _outMips.levels[0]);
+		}
+
+		for (uint8_t* data : sourceData)
+			stbi_image_free(data);
+
+		return bSuccess;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool bPack = argc > 1 && std::strcmp(argv[1], "--pack") == 0;
+
+	// Input paths then output path.
+	const int pathEnd = bPack ? 6 : 3;
+
+	if (argc < pathEnd)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	const char* const inputPath = bPack ? "packed channels" : argv[1];
+	const char* const outputPath = argv[pathEnd - 1];
+
+	CookSettings settings;
+	DeduceFormat(bPack ? outputPath : inputPath, bPack, settings);
+
+	for (int i = pathEnd; i < argc; i += 2)
+	{
+		if (i + 1 >= argc)
+		{
+			PrintUsage();
+			return 1;
+		}
+
+		bool bValid = false;
+
+		if (std::strcmp(argv[i], "--format") == 0)
+			bValid = ParseFormat(argv[i + 1], settings);
+		else if (std::strcmp(argv[i], "--quality") == 0)
+			bValid = ParseQuality(argv[i + 1], settings);
+		else if (std::strcmp(argv[i], "--filter") == 0)
+			bValid = ParseFilter(argv[i + 1], settings);
+
+		if (!bValid)
+		{
+			std::printf("Invalid option: %s %s\n", argv[i], argv[i + 1]);
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	// Same convention as the runtime image loading (DirectX UV origin is top-left).
+	stbi_set_flip_vertically_on_load(true);
+
+	MipChain mips;
+
+	if (bPack)
+	{
+		// Linear by default (see DeduceFormat()), sRGB if requested with --format.
+		if (!LoadPackedImage(argv + 2, settings.bSRGB ? ImageFormat::RGBA8_SRGB : ImageFormat::RGBA8, mips))
+			return 1;
+
+		GenerateMipChain(mips.levels.data(), static_cast<uint32_t>(mips.levels.size()), mips.format, settings.filter);
+	}
+	else
+	{
+		// BC4 only reads the R channel: load as single channel.
+		const bool bSingleChannel = settings.format == BCFormat::BC4;
+
+		int width, height, channels;
+		uint8_t* const inData = stbi_load(inputPath, &width, &height, &channels, bSingleChannel ? 1 : 4);
+		if (!inData)
+		{
+			std::printf("Failed to load %s: %s\n", inputPath, stbi_failure_reason());
+			return 1;
+		}
+
+		// Mips are filtered in linear space for sRGB data.
+		const ImageFormat imageFormat = bSingleChannel ? ImageFormat::R8 : (settings.bSRGB ? ImageFormat::RGBA8_SRGB : ImageFormat::RGBA8);
+
+		mips = CreateMipChain(inData, static_cast<uint32_t>(width), static_cast<uint32_t>(height), imageFormat, settings.filter);
+
+		stbi_image_free(inData);
+	}
+
+	size_t outputSize = 0u;
+
+	if (EndsWith(outputPath, ".ktx2"))
+	{
+		if (!WriteBasisKTX2(outputPath, mips, settings.bSRGB, outputSize))
+		{
+			std::printf("Failed to write %s\n", outputPath);
+			return 1;
+		}
+	}
+	else
+	{
+		const BCMipChain bcMips = EncodeMipChainBC(mips, settings.format, settings.quality);
+
+		if (!WriteDDS(outputPath, bcMips))
+		{
+			std::printf("Failed to write %s\n", outputPath);
+			return 1;
+		}
+
+		outputSize = bcMips.data.size();
+	}
+
+	const auto end = std::chrono::steady_clock::now();
+
+	std::printf("Cooked %s -> %s (%ux%u, %zu mips, %zu bytes) in %.1f ms\n", inputPath, outputPath, mips.levels[0].width, mips.levels[0].height,
+		mips.levels.size(), outputSize, std::chrono::duration<double, std::milli>(end - start).count());
+
+	return 0;
+}